@@ -0,0 +1,115 @@
+// Utilidades comuns dos micro-benchmarks
+// Mede ciclos de clk_sys com o SysTick e imprime uma tabela separada por ';'
+// Com BENCH_HOST (bench/host), a mesma interface mede nanossegundos do relógio
+// monotônico do host; os casos em bench_display.c e bench_matriz.c são os mesmos
+// As duas tabelas saem no mesmo fluxo: cada linha começa com o nome da sua
+// tabela ("custo;" ou "saida;"), como nos relatórios de tools/
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <stdio.h>
+#include "pico/stdlib.h"
+
+#ifndef BENCH_HOST
+
+#include "hardware/clocks.h"
+#include "hardware/structs/systick.h"
+
+#define REPETICOES 32
+
+// Inicia o SysTick em modo livre (24 bits, clock do processador)
+static inline void systick_iniciar(void) {
+    systick_hw->csr = 0;
+    systick_hw->rvr = 0x00FFFFFF;
+    systick_hw->cvr = 0;
+    systick_hw->csr = 0x5; // ENABLE | CLKSOURCE
+}
+
+static inline uint32_t systick_ler(void) {
+    return systick_hw->cvr;
+}
+
+// O SysTick conta para baixo
+static inline uint32_t ciclos_desde(uint32_t inicio) {
+    return (inicio - systick_ler()) & 0x00FFFFFF;
+}
+
+#define BENCH_CABECALHO_CUSTO "custo;caso;ciclos;ciclos_referencia"
+#define BENCH_CABECALHO_SAIDAS "saida;caso;ciclos;ns;bytes"
+static inline void bench_imprimir_medida(uint32_t ciclos) {
+    printf("%lu;%lu", (unsigned long)ciclos,
+           (unsigned long)((uint64_t)ciclos * 1000000000u / clock_get_hz(clk_sys)));
+}
+
+#else
+
+#include <time.h>
+
+#define REPETICOES 1000
+
+static inline void systick_iniciar(void) {}
+
+// No host, "ciclos" são nanossegundos do relógio monotônico
+static inline uint32_t systick_ler(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)((uint64_t)t.tv_sec * 1000000000u + (uint64_t)t.tv_nsec);
+}
+
+static inline uint32_t ciclos_desde(uint32_t inicio) {
+    return systick_ler() - inicio;
+}
+
+#define BENCH_CABECALHO_CUSTO "custo;caso;ns;ns_referencia"
+#define BENCH_CABECALHO_SAIDAS "saida;caso;ns;bytes"
+static inline void bench_imprimir_medida(uint32_t ns) {
+    printf("%lu", (unsigned long)ns);
+}
+
+#endif /* BENCH_HOST */
+
+// Mede cada repetição separadamente para não estourar os 24 bits do SysTick
+#define MEDIR(expr, resultado) do {                         \
+        uint32_t _soma = 0;                                 \
+        for (int _r = 0; _r < REPETICOES; ++_r) {           \
+            uint32_t _t0 = systick_ler();                   \
+            expr;                                           \
+            _soma += ciclos_desde(_t0);                     \
+        }                                                   \
+        resultado = _soma / REPETICOES;                     \
+    } while (0)
+
+// Como MEDIR, com um preparo fora da medição antes de cada repetição
+#define MEDIR_PREPARADO(preparo, expr, resultado) do {      \
+        uint32_t _soma = 0;                                 \
+        for (int _r = 0; _r < REPETICOES; ++_r) {           \
+            preparo;                                        \
+            uint32_t _t0 = systick_ler();                   \
+            expr;                                           \
+            _soma += ciclos_desde(_t0);                     \
+        }                                                   \
+        resultado = _soma / REPETICOES;                     \
+    } while (0)
+
+// Linha da tabela de custo: ciclos e ciclos da implementação de referência
+static inline void bench_imprimir(const char *nome, uint32_t ciclos, uint32_t referencia) {
+    printf("custo;%s;%lu;%lu\n", nome, (unsigned long)ciclos, (unsigned long)referencia);
+}
+
+// Linha da tabela de saídas: custo por chamada e bytes que ela põe no barramento
+static inline void bench_imprimir_saida(const char *nome, uint32_t ciclos, uint32_t bytes) {
+    printf("saida;%s;", nome);
+    bench_imprimir_medida(ciclos);
+    printf(";%lu\n", (unsigned long)bytes);
+}
+
+void bench_display(void);
+void bench_display_saidas(void);
+void bench_matriz(void);
+void bench_sensor(void);
+void bench_filtro(void);
+void bench_tendencia(void);
+void bench_previsao(void);
+void bench_formato(void);
+
+#endif /* BENCH_H */
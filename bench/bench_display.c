@@ -0,0 +1,298 @@
+// Micro-benchmark das primitivas de desenho do SSD1306
+// Mede ciclos de clk_sys com o SysTick e compara cada primitiva com o
+// equivalente desenhado pixel a pixel via ssd1306_pixel (implementação antiga).
+// bench_display_saidas mede cada função pública e as telas de tarefa_exibicao,
+// com os bytes que o flush seguinte põe no I2C (o display precisa estar ligado)
+#include <stdlib.h>
+#include "bench.h"
+#include "ssd1306.h"
+#include "telas.h"
+#include "font.h"
+#include "hardware/i2c.h"
+
+#define I2C_SDA_PIN 14
+#define I2C_SCL_PIN 15
+
+static ssd1306_t display;
+
+static void iniciar_display(void) {
+    static bool iniciado = false;
+    if (iniciado) return;
+    i2c_init(i2c1, 400 * 1000);
+    gpio_set_function(I2C_SDA_PIN, GPIO_FUNC_I2C);
+    gpio_set_function(I2C_SCL_PIN, GPIO_FUNC_I2C);
+    gpio_pull_up(I2C_SDA_PIN);
+    gpio_pull_up(I2C_SCL_PIN);
+    ssd1306_init(&display, 128, 64, false, 0x3C, i2c1);
+    ssd1306_config(&display);
+    iniciado = true;
+}
+
+// --- Referências pixel a pixel ---
+
+static void ref_fill(bool v) {
+    for (uint8_t y = 0; y < display.height; ++y)
+        for (uint8_t x = 0; x < display.width; ++x)
+            ssd1306_pixel(&display, x, y, v);
+}
+
+static void ref_hline(uint8_t x0, uint8_t x1, uint8_t y) {
+    for (uint8_t x = x0; x <= x1; ++x) ssd1306_pixel(&display, x, y, true);
+}
+
+static void ref_vline(uint8_t x, uint8_t y0, uint8_t y1) {
+    for (uint8_t y = y0; y <= y1; ++y) ssd1306_pixel(&display, x, y, true);
+}
+
+static void ref_rect_fill(uint8_t top, uint8_t left, uint8_t w, uint8_t h) {
+    for (uint8_t x = left; x < left + w; ++x)
+        for (uint8_t y = top; y < top + h; ++y)
+            ssd1306_pixel(&display, x, y, true);
+}
+
+static void ref_line(int x0, int y0, int x1, int y1) {
+    int dx = abs(x1 - x0), dy = abs(y1 - y0);
+    int sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
+    int err = dx - dy;
+    while (1) {
+        ssd1306_pixel(&display, x0, y0, true);
+        if (x0 == x1 && y0 == y1) break;
+        int e2 = err * 2;
+        if (e2 > -dy) { err -= dy; x0 += sx; }
+        if (e2 < dx) { err += dx; y0 += sy; }
+    }
+}
+
+// ssd1306_draw_char antigo: mapeia o caractere para o índice em font.h e
+// desenha pixel a pixel, com os símbolos girados
+static void ref_char(char c, uint8_t x, uint8_t y) {
+    uint16_t index = 0;
+    bool rotate = false;
+
+    if (c >= '0' && c <= '9') {
+        index = (c - '0' + 1) * 8;
+    } else if (c >= 'A' && c <= 'Z') {
+        index = (c - 'A' + 11) * 8;
+    } else if (c >= 'a' && c <= 'z') {
+        index = (c - 'a' + 37) * 8;
+    } else if (c == ':') {
+        index = 64 * 8;
+        rotate = true;
+    } else if (c == '.') {
+        index = 65 * 8;
+        rotate = true;
+    } else if (c == '>') {
+        index = 66 * 8;
+        rotate = true;
+    } else if (c == '-') {
+        index = 67 * 8;
+        rotate = true;
+    } else if (c == 127) {
+        index = 68 * 8;
+    } else if (c == '!') {
+        index = 69 * 8;
+        rotate = true;
+    } else if (c == '%') {
+        index = 70 * 8;
+        rotate = true;
+    } else {
+        return;
+    }
+
+    for (uint8_t i = 0; i < 8; ++i) {
+        uint8_t line = font[index + i];
+        for (uint8_t j = 0; j < 8; ++j)
+            ssd1306_pixel(&display, x + (rotate ? (7 - j) : i), y + (rotate ? i : j), (line >> j) & 0x01);
+    }
+}
+
+// ssd1306_draw_string antigo, sem números pequenos
+static void ref_string(const char *str, uint8_t x, uint8_t y) {
+    for (; *str; ++str, x += 8) {
+        if (x + 8 > display.width) {
+            x = 0;
+            y += 8;
+            if (y + 8 > display.height) break;
+        }
+        ref_char(*str, x, y);
+    }
+}
+
+void bench_display(void) {
+    iniciar_display();
+
+    uint32_t c_novo, c_ref;
+    MEDIR(ssd1306_fill(&display, false), c_novo);
+    MEDIR(ref_fill(false), c_ref);
+    bench_imprimir("fill", c_novo, c_ref);
+
+    MEDIR(ssd1306_hline(&display, 0, 127, 37, true), c_novo);
+    MEDIR(ref_hline(0, 127, 37), c_ref);
+    bench_imprimir("hline_128", c_novo, c_ref);
+
+    MEDIR(ssd1306_vline(&display, 15, 9, 54, true), c_novo);
+    MEDIR(ref_vline(15, 9, 54), c_ref);
+    bench_imprimir("vline_46", c_novo, c_ref);
+
+    MEDIR(ssd1306_rect(&display, 10, 0, 108, 8, true, false), c_novo);
+    MEDIR((ref_hline(0, 107, 10), ref_hline(0, 107, 17), ref_vline(0, 10, 17), ref_vline(107, 10, 17)), c_ref);
+    bench_imprimir("rect_108x8", c_novo, c_ref);
+
+    MEDIR(ssd1306_rect(&display, 11, 1, 106, 6, true, true), c_novo);
+    MEDIR(ref_rect_fill(11, 1, 106, 6), c_ref);
+    bench_imprimir("rect_fill_106x6", c_novo, c_ref);
+
+    MEDIR(ssd1306_rect(&display, 0, 0, 128, 64, true, true), c_novo);
+    MEDIR(ref_rect_fill(0, 0, 128, 64), c_ref);
+    bench_imprimir("rect_fill_128x64", c_novo, c_ref);
+
+    MEDIR(ssd1306_line(&display, 15, 54, 26, 9, true), c_novo);
+    MEDIR(ref_line(15, 54, 26, 9), c_ref);
+    bench_imprimir("line_diag_11x45", c_novo, c_ref);
+
+    MEDIR(ssd1306_draw_string(&display, "Nivel: 42.5%", 0, 24, false), c_novo);
+    MEDIR(ref_string("Nivel: 42.5%", 0, 24), c_ref);
+    bench_imprimir("draw_string_12_alinhado", c_novo, c_ref);
+
+    MEDIR(ssd1306_draw_string(&display, "Nivel: 42.5%", 0, 26, false), c_novo);
+    MEDIR(ref_string("Nivel: 42.5%", 0, 26), c_ref);
+    bench_imprimir("draw_string_12_desalinhado", c_novo, c_ref);
+}
+
+// --- Tabela de saídas ---
+
+// Bytes do flush incremental que leva a tela limpa ao resultado de expr
+#define BYTES_APOS(expr, bytes) do {                        \
+        ssd1306_fill(&display, false);                      \
+        ssd1306_send_data(&display);                        \
+        expr;                                               \
+        ssd1306_send_data(&display);                        \
+        bytes = display.bytes_last_flush;                   \
+    } while (0)
+
+// Mede expr sobre o buffer e imprime a linha com os bytes que ela custa no barramento
+#define CASO(nome, expr) do {                               \
+        uint32_t _c, _b;                                    \
+        MEDIR(expr, _c);                                    \
+        BYTES_APOS(expr, _b);                               \
+        bench_imprimir_saida(nome, _c, _b);                 \
+    } while (0)
+
+// Duas leituras consecutivas: tudo o que a tela mostra muda entre elas
+static telas_grafico_t graficos[2];
+static telas_valores_t leituras[2] = {
+    {.chuva_mmh = 1234, .chuva_pct = 4567, .nivel_pct = 6543, .alerta = false,
+     .previsao_valida = true, .nivel_previsto = 6600, .grafico = &graficos[0]},
+    {.chuva_mmh = 1310, .chuva_pct = 4712, .nivel_pct = 7021, .alerta = true,
+     .previsao_valida = true, .nivel_previsto = 7250, .grafico = &graficos[1]},
+};
+
+// Histórico cheio; a segunda leitura acrescenta um ponto ao anel
+static void preparar_graficos(void) {
+    for (int i = 0; i < TELAS_GRAFICO_PONTOS; ++i) {
+        graficos[0].chuva[i] = (uint16_t)(3000 + i * 170);
+        graficos[0].nivel[i] = (uint16_t)(5200 + i * 135);
+    }
+    graficos[0].indice = 0;
+    graficos[0].contagem = TELAS_GRAFICO_PONTOS;
+    graficos[1] = graficos[0];
+    graficos[1].chuva[0] = leituras[1].chuva_pct;
+    graficos[1].nivel[0] = leituras[1].nivel_pct;
+    graficos[1].indice = 1;
+}
+
+static void desenhar_tela(uint8_t tela, const telas_valores_t *valores) {
+    telas_montar_fundo(&display, tela);
+    telas_desenhar_valores(&display, tela, valores);
+}
+
+static void bench_telas(void) {
+    static uint8_t fundo[128 * 64 / 8];
+    char nome[24];
+    uint32_t c;
+
+    for (uint8_t tela = 0; tela < TELAS_QUANTIDADE; ++tela) {
+        // Troca de tela: fundo montado do zero; bytes a partir da tela anterior já no display
+        MEDIR(telas_montar_fundo(&display, tela), c);
+        desenhar_tela((tela + TELAS_QUANTIDADE - 1) % TELAS_QUANTIDADE, &leituras[0]);
+        ssd1306_send_data(&display);
+        desenhar_tela(tela, &leituras[0]);
+        ssd1306_send_data(&display);
+        snprintf(nome, sizeof(nome), "tela%u_fundo", tela);
+        bench_imprimir_saida(nome, c, display.bytes_last_flush);
+
+        // Quadro de uma leitura nova: cópia do fundo + valores, como em tarefa_exibicao
+        telas_montar_fundo(&display, tela);
+        ssd1306_save_layer(&display, fundo);
+        MEDIR((ssd1306_load_layer(&display, fundo), telas_desenhar_valores(&display, tela, &leituras[_r & 1])), c);
+        ssd1306_load_layer(&display, fundo);
+        telas_desenhar_valores(&display, tela, &leituras[0]);
+        ssd1306_send_data(&display);
+        ssd1306_load_layer(&display, fundo);
+        telas_desenhar_valores(&display, tela, &leituras[1]);
+        ssd1306_send_data(&display);
+        snprintf(nome, sizeof(nome), "tela%u_quadro", tela);
+        bench_imprimir_saida(nome, c, display.bytes_last_flush);
+    }
+}
+
+static void bench_flush(void) {
+    uint32_t c;
+
+    // Quadro inteiro (primeiro flush ou após ssd1306_invalidate)
+    desenhar_tela(0, &leituras[0]);
+    MEDIR((ssd1306_invalidate(&display), ssd1306_send_data(&display)), c);
+    bench_imprimir_saida("send_data_completo", c, display.bytes_last_flush);
+
+    MEDIR(ssd1306_send_data(&display), c);
+    bench_imprimir_saida("send_data_sem_mudanca", c, display.bytes_last_flush);
+
+    // Um valor da tela 1 muda: só a janela do texto sai no barramento
+    MEDIR_PREPARADO(ssd1306_draw_string(&display, (_r & 1) ? "12.3%" : "45.6%", 7 * 8, 13, false),
+                    ssd1306_send_data(&display), c);
+    bench_imprimir_saida("send_data_um_valor", c, display.bytes_last_flush);
+
+    // Assíncrono: só a montagem do stream; a transferência corre no DMA fora da medição
+    MEDIR_PREPARADO((ssd1306_wait_flush(&display), ssd1306_invalidate(&display)),
+                    ssd1306_send_data_async(&display), c);
+    ssd1306_wait_flush(&display);
+    bench_imprimir_saida("send_data_async_completo", c, display.bytes_last_flush);
+
+    MEDIR_PREPARADO((ssd1306_wait_flush(&display),
+                     ssd1306_draw_string(&display, (_r & 1) ? "12.3%" : "45.6%", 7 * 8, 13, false)),
+                    ssd1306_send_data_async(&display), c);
+    ssd1306_wait_flush(&display);
+    bench_imprimir_saida("send_data_async_um_valor", c, display.bytes_last_flush);
+}
+
+void bench_display_saidas(void) {
+    static uint8_t camada[128 * 64 / 8];
+
+    iniciar_display();
+    preparar_graficos();
+
+    CASO("pixel", ssd1306_pixel(&display, 64, 32, true));
+    CASO("fill", ssd1306_fill(&display, true));
+    CASO("hline_128", ssd1306_hline(&display, 0, 127, 37, true));
+    CASO("vline_46", ssd1306_vline(&display, 15, 9, 54, true));
+    CASO("line_horizontal_100", ssd1306_line(&display, 15, 54, 115, 54, true));
+    CASO("line_diag_11x45", ssd1306_line(&display, 15, 54, 26, 9, true));
+    CASO("line_diag_100x45", ssd1306_line(&display, 15, 54, 115, 9, true));
+    CASO("rect_108x8", ssd1306_rect(&display, 10, 0, 108, 8, true, false));
+    CASO("rect_fill_106x6", ssd1306_rect(&display, 11, 1, 106, 6, true, true));
+    CASO("rect_fill_128x64", ssd1306_rect(&display, 0, 0, 128, 64, true, true));
+    CASO("draw_char", ssd1306_draw_char(&display, 'A', 64, 24, false));
+    CASO("draw_string_12_alinhado", ssd1306_draw_string(&display, "Nivel: 42.5%", 0, 24, false));
+    CASO("draw_string_12_desalinhado", ssd1306_draw_string(&display, "Nivel: 42.5%", 0, 26, false));
+    CASO("draw_string_pequeno_7", ssd1306_draw_string(&display, "Chuva %", 46, 5, true));
+
+    // Camadas: a cópia não toca o barramento; carregar a camada da tela 0 sobre a tela limpa custa o quadro
+    uint32_t c;
+    desenhar_tela(0, &leituras[0]);
+    MEDIR(ssd1306_save_layer(&display, camada), c);
+    bench_imprimir_saida("save_layer", c, 0);
+    CASO("load_layer", ssd1306_load_layer(&display, camada));
+
+    bench_flush();
+    bench_telas();
+}
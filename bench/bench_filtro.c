@@ -0,0 +1,27 @@
+// Micro-benchmark dos filtros de fluxo: ciclos por amostra no alvo
+// A taxa de alertas falsos sobre traços ruidosos é medida no host
+// (bench/host/bench_filtro_host.c)
+#include "bench.h"
+#include "filtro.h"
+
+static volatile uint16_t entradas[REPETICOES];
+static volatile uint16_t saida;
+
+static void medir(const char *nome, filtro_tipo_t tipo, uint8_t parametro) {
+    filtro_t f;
+    uint32_t ciclos, referencia;
+    filtro_iniciar(&f, tipo, parametro);
+    for (int i = 0; i < REPETICOES; ++i) filtro_atualizar(&f, entradas[i]); // Janela cheia
+    MEDIR(saida = filtro_atualizar(&f, entradas[_r]), ciclos);
+    MEDIR(saida = entradas[_r], referencia);  // Custo do laço de medição
+    bench_imprimir(nome, ciclos, referencia);
+}
+
+void bench_filtro(void) {
+    for (int i = 0; i < REPETICOES; ++i) entradas[i] = (uint16_t)((i * 7919u) & 0xFFFF);
+
+    medir("filtro_mediana_5", FILTRO_MEDIANA, 5);
+    medir("filtro_mediana_9", FILTRO_MEDIANA, 9);
+    medir("filtro_ema_2", FILTRO_EMA, 2);
+    medir("filtro_media_movel_8", FILTRO_MEDIA_MOVEL, 8);
+}
@@ -0,0 +1,30 @@
+// Micro-benchmark da formatação dos valores das telas
+// Compara formato_fixo com o snprintf inteiro que telas.c usava e com o
+// "%.2f" em float, que o firmware deixou de ligar (PICO_PRINTF_SUPPORT_FLOAT=0)
+#include <stdio.h>
+#include "bench.h"
+#include "formato.h"
+
+static volatile uint16_t entradas[REPETICOES];
+static char texto[16];
+
+void bench_formato(void) {
+    for (int i = 0; i < REPETICOES; ++i) entradas[i] = (uint16_t)(i * 3500 / (REPETICOES - 1));
+
+    uint32_t c_novo, c_ref;
+    MEDIR(formato_inteiro(texto, sizeof(texto), entradas[_r] / 35, NULL), c_novo);
+    MEDIR(snprintf(texto, sizeof(texto), "%d", entradas[_r] / 35), c_ref);
+    bench_imprimir("formato_inteiro", c_novo, c_ref);
+
+    // Chuva em mm/h (centésimos): "12.34mm"
+    MEDIR(formato_fixo(texto, sizeof(texto), entradas[_r], 2, "mm"), c_novo);
+    MEDIR(snprintf(texto, sizeof(texto), "%u.%02umm", entradas[_r] / 100, entradas[_r] % 100), c_ref);
+    bench_imprimir("formato_fixo_2casas", c_novo, c_ref);
+    MEDIR(snprintf(texto, sizeof(texto), "%.2fmm", entradas[_r] / 100.0f), c_ref);
+    bench_imprimir("formato_fixo_2casas_float", c_novo, c_ref);
+
+    // Percentual em décimos: "45.6%"
+    MEDIR(formato_fixo(texto, sizeof(texto), entradas[_r] / 10, 1, "%"), c_novo);
+    MEDIR(snprintf(texto, sizeof(texto), "%u.%u%%", entradas[_r] / 100, entradas[_r] / 10 % 10), c_ref);
+    bench_imprimir("formato_fixo_1casa", c_novo, c_ref);
+}
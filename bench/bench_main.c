@@ -0,0 +1,25 @@
+// Executável dos micro-benchmarks (sem FreeRTOS)
+#include "bench.h"
+
+int main() {
+    stdio_init_all();
+    sleep_ms(2000);
+
+    systick_iniciar();
+    printf(BENCH_CABECALHO_CUSTO "\n");
+    bench_display();
+    bench_sensor();
+    bench_filtro();
+    bench_tendencia();
+    bench_previsao();
+    bench_formato();
+
+    // Custo por chamada de cada saída e bytes postos no barramento
+    printf(BENCH_CABECALHO_SAIDAS "\n");
+    bench_display_saidas();
+    bench_matriz();
+
+    while (true) {
+        sleep_ms(1000);
+    }
+}
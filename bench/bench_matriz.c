@@ -0,0 +1,48 @@
+// Micro-benchmark da matriz WS2812 (matriz_led.c)
+// O desenho só escreve no quadro em RAM; os bytes saem em matriz_flush,
+// contados pelo próprio driver (3 por pixel GRB)
+#include "bench.h"
+#include "matriz_led.h"
+
+// Um quadro inteiro ocupa a linha por NUM_PIXELS * 30 us mais o reset
+#define QUADRO_NA_LINHA_US (NUM_PIXELS * WS2812_US_POR_PIXEL + WS2812_RESET_US)
+
+static volatile uint8_t numero;
+
+// Bytes médios por chamada desde a contagem inicial
+static uint32_t bytes_por_chamada(uint32_t antes) {
+    return (matriz_bytes_total() - antes) / REPETICOES;
+}
+
+void bench_matriz(void) {
+    uint32_t c, antes;
+
+    inicializar_matriz_led();
+
+    antes = matriz_bytes_total();
+    MEDIR(matriz_draw_pattern(PAD_X, COR_VERMELHO), c);
+    bench_imprimir_saida("matriz_draw_pattern", c, bytes_por_chamada(antes));
+
+    antes = matriz_bytes_total();
+    MEDIR(matriz_draw_number(numero = _r % 10, COR_AZUL), c);
+    bench_imprimir_saida("matriz_draw_number", c, bytes_por_chamada(antes));
+
+    antes = matriz_bytes_total();
+    MEDIR(matriz_clear(), c);
+    bench_imprimir_saida("matriz_clear", c, bytes_por_chamada(antes));
+
+    // Quadro novo a cada chamada, com a linha já livre: comparação, cópia e disparo do DMA
+    antes = matriz_bytes_total();
+    MEDIR_PREPARADO((sleep_us(QUADRO_NA_LINHA_US), matriz_draw_number(_r % 10, COR_AZUL)),
+                    matriz_flush(), c);
+    bench_imprimir_saida("matriz_flush", c, bytes_por_chamada(antes));
+
+    // Quadro igual ao último enviado: só a comparação
+    antes = matriz_bytes_total();
+    MEDIR(matriz_flush(), c);
+    bench_imprimir_saida("matriz_flush_sem_mudanca", c, bytes_por_chamada(antes));
+
+    sleep_us(QUADRO_NA_LINHA_US);
+    matriz_clear();
+    matriz_flush();
+}
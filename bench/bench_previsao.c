@@ -0,0 +1,31 @@
+// Micro-benchmark dos preditores de nível: ciclos por leitura no alvo
+// (preditor_atualizar + preditor_prever, como em tarefa_previsao)
+// O erro de previsão de cada modelo é medido no host (bench/host/backtest_previsao.c)
+#include "bench.h"
+#include "preditor.h"
+
+#define JANELA_LINEAR 4800
+
+static uint16_t janela[JANELA_LINEAR];
+static volatile uint16_t entradas[REPETICOES];
+static volatile uint16_t saida;
+
+static void medir(const char *nome, preditor_t *p) {
+    uint32_t ciclos, referencia;
+    for (uint32_t i = 0; i < JANELA_LINEAR; ++i) preditor_atualizar(p, entradas[i % REPETICOES]);
+    MEDIR(preditor_atualizar(p, entradas[_r]); saida = preditor_prever(p, 10, 150), ciclos);
+    MEDIR(saida = entradas[_r], referencia);  // Custo do laço de medição
+    bench_imprimir(nome, ciclos, referencia);
+}
+
+void bench_previsao(void) {
+    preditor_t p;
+    for (int i = 0; i < REPETICOES; ++i) entradas[i] = (uint16_t)(5000 + ((i * 7919u) & 0x3FF));
+
+    preditor_iniciar_linear(&p, janela, JANELA_LINEAR);
+    medir("preditor_linear_4800", &p);
+    preditor_iniciar_holt(&p, 5, 10);
+    medir("preditor_holt", &p);
+    preditor_iniciar_kalman(&p, 0.001f, 50.0f);
+    medir("preditor_kalman", &p);
+}
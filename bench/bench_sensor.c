@@ -0,0 +1,45 @@
+// Micro-benchmark da conversão de uma amostra dos sensores
+// Compara o caminho em ponto fixo (tabelas geradas + limiares inteiros) com o
+// cálculo em float que a tarefa de medição fazia antes
+#include "bench.h"
+#include "sensor.h"
+
+static volatile uint16_t entradas[REPETICOES];
+static volatile bool alerta;
+static volatile uint16_t saida_u16;
+static volatile float saida_f;
+
+// Caminho atual: uma amostra de nível e uma de chuva
+static void amostra_ponto_fixo(uint16_t raw_nivel, uint16_t raw_chuva) {
+    uint16_t nivel = sensor_percentual_x100(sensor_normalizar_adc(raw_nivel));
+    uint16_t chuva16 = sensor_normalizar_adc(raw_chuva);
+    uint16_t chuva = sensor_percentual_x100(chuva16);
+    saida_u16 = sensor_chuva_mmh_x100(chuva16);
+    alerta = (nivel >= PCT_X100(70) || chuva >= PCT_X100(80));
+}
+
+// Referência: conversão por faixas em float, como era em main.c
+static float ref_percentual_para_mmh(float percentual) {
+    if (percentual <= 0.0f) return 0.0f;
+    else if (percentual < 30.0f) return (percentual / 30.0f) * 5.0f;
+    else if (percentual < 60.0f) return 5.0f + ((percentual - 30.0f) / 30.0f) * 10.0f;
+    else if (percentual < 80.0f) return 15.0f + ((percentual - 60.0f) / 20.0f) * 15.0f;
+    else if (percentual < 95.0f) return 30.0f + ((percentual - 80.0f) / 15.0f) * 5.0f;
+    else return 35.0f;
+}
+
+static void amostra_float(uint16_t raw_nivel, uint16_t raw_chuva) {
+    float nivel = (raw_nivel / 4095.0f) * 100.0f;
+    float chuva = (raw_chuva / 4095.0f) * 100.0f;
+    saida_f = ref_percentual_para_mmh(chuva);
+    alerta = (nivel >= 70.0f || chuva >= 80.0f);
+}
+
+void bench_sensor(void) {
+    for (int i = 0; i < REPETICOES; ++i) entradas[i] = (uint16_t)(i * 4095 / (REPETICOES - 1));
+
+    uint32_t c_novo, c_ref;
+    MEDIR(amostra_ponto_fixo(entradas[_r], entradas[REPETICOES - 1 - _r]), c_novo);
+    MEDIR(amostra_float(entradas[_r], entradas[REPETICOES - 1 - _r]), c_ref);
+    bench_imprimir("amostra_sensores", c_novo, c_ref);
+}
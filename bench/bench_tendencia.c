@@ -0,0 +1,48 @@
+// Micro-benchmark da regressão de tendência: ciclos por amostra no alvo
+// Referência: o cálculo antigo de tarefa_previsao, que refazia as somas em float
+#include "bench.h"
+#include "tendencia.h"
+
+#define JANELA_LONGA 4800
+
+static uint16_t buffer[JANELA_LONGA];
+static float historico[JANELA_LONGA];
+static volatile uint16_t entradas[REPETICOES];
+static volatile int32_t saida;
+static volatile float saida_ref;
+
+// Somas refeitas a cada amostra, com índice modular (implementação anterior)
+static float inclinacao_ref(int n, int indice) {
+    float soma_x = 0.0f, soma_y = 0.0f, soma_xy = 0.0f, soma_x2 = 0.0f;
+    for (int i = 0; i < n; i++) {
+        float x_val = (float)i;
+        float y_val = historico[(indice + i) % n];
+        soma_x += x_val;
+        soma_y += y_val;
+        soma_xy += x_val * y_val;
+        soma_x2 += x_val * x_val;
+    }
+    float denominador = n * soma_x2 - soma_x * soma_x;
+    return denominador != 0.0f ? (n * soma_xy - soma_x * soma_y) / denominador : 0.0f;
+}
+
+static void medir(const char *nome, uint16_t n) {
+    tendencia_t t;
+    uint32_t ciclos, referencia;
+    tendencia_iniciar(&t, buffer, n);
+    for (uint32_t i = 0; i < n; ++i) {
+        tendencia_adicionar(&t, entradas[i % REPETICOES]);     // Janela cheia
+        historico[i] = entradas[i % REPETICOES] / 100.0f;
+    }
+    MEDIR(tendencia_adicionar(&t, entradas[_r]); saida = tendencia_inclinacao_q12(&t), ciclos);
+    MEDIR(historico[_r] = entradas[_r] / 100.0f; saida_ref = inclinacao_ref(n, _r + 1), referencia);
+    bench_imprimir(nome, ciclos, referencia);
+}
+
+void bench_tendencia(void) {
+    for (int i = 0; i < REPETICOES; ++i) entradas[i] = (uint16_t)(5000 + ((i * 7919u) & 0x3FF));
+
+    medir("tendencia_5", 5);
+    medir("tendencia_600", 600);
+    medir("tendencia_4800", JANELA_LONGA);
+}
@@ -0,0 +1,219 @@
+// Backtest de host dos preditores de nível (preditor.c)
+// Reproduz traços de cheia leitura a leitura (4 leituras/s, como tarefa_previsao)
+// e compara a previsão feita em t com o nível medido em t + horizonte.
+// Imprime erro médio absoluto, RMS e máximo (pontos percentuais), tempo por
+// atualização no host e RAM de cada modelo. Ciclos no alvo: bench_previsao.
+//
+// Uso: backtest_previsao [-h horizonte] [traco.csv ...]
+// Sem arquivos usa hidrogramas sintéticos determinísticos. Cada linha do CSV
+// é uma leitura: "nivel_x100[,chuva_mmh_x100]" (centésimos, ver sensor.h).
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "preditor.h"
+
+#define MAX_AMOSTRAS 400000
+#define LEITURAS_POR_S 4
+#define AQUECIMENTO (60 * LEITURAS_POR_S)   // Primeiro minuto fora das métricas
+#define PASSADAS_TEMPO 5
+#define JANELA_MAX 4800
+#define PI 3.14159265358979323846
+
+typedef struct {
+    const char *nome;
+    uint32_t n;
+    uint16_t *nivel;        // Centésimos de %
+    uint16_t *chuva;        // Centésimos de mm/h
+} traco_t;
+
+typedef struct {
+    preditor_tipo_t tipo;
+    uint16_t janela;                // Linear
+    uint8_t alfa_shift, beta_shift; // Holt
+    float desvio_processo, desvio_medida; // Kalman
+} config_preditor_t;
+
+static const config_preditor_t configs[] = {
+    {PREDITOR_LINEAR, 5, 0, 0, 0, 0},        // Modelo original (1,25 s de histórico)
+    {PREDITOR_LINEAR, 1200, 0, 0, 0, 0},     // 5 minutos
+    {PREDITOR_LINEAR, 4800, 0, 0, 0, 0},     // 20 minutos
+    {PREDITOR_HOLT, 0, 3, 7, 0, 0},
+    {PREDITOR_HOLT, 0, 5, 10, 0, 0},
+    {PREDITOR_KALMAN, 0, 0, 0, 0.01f, 50.0f},
+    {PREDITOR_KALMAN, 0, 0, 0, 0.001f, 50.0f},
+};
+
+static const uint32_t horizontes_padrao[] = {10, 60 * LEITURAS_POR_S, 600 * LEITURAS_POR_S};
+
+static uint16_t janela[JANELA_MAX];
+
+// Gerador determinístico (xorshift) para os traços sintéticos
+static uint32_t semente = 0x12345678u;
+static double aleatorio(void) {
+    semente ^= semente << 13;
+    semente ^= semente >> 17;
+    semente ^= semente << 5;
+    return (semente >> 8) / 16777216.0;
+}
+
+static double gaussiano(void) {
+    double u1 = aleatorio() + 1e-12, u2 = aleatorio();
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * PI * u2);
+}
+
+static uint16_t saturar(double v, double max) {
+    if (v < 0.0) return 0;
+    if (v > max) return (uint16_t)max;
+    return (uint16_t)(v + 0.5);
+}
+
+// Hidrograma sintético: reservatório linear alimentado pela chuva
+//   dN/dt = ganho * chuva - (N - base) / constante
+// Chuva em pulso senoidal de 'duracao_min' minutos com pico 'pico_mmh'
+static void gerar_traco(traco_t *t, const char *nome, uint32_t minutos, double base_pct,
+                        double inicio_min, double duracao_min, double pico_mmh, double ruido_pct) {
+    t->nome = nome;
+    t->n = minutos * 60 * LEITURAS_POR_S;
+    t->nivel = malloc(t->n * sizeof(uint16_t));
+    t->chuva = malloc(t->n * sizeof(uint16_t));
+    const double dt_min = 1.0 / (60.0 * LEITURAS_POR_S);
+    const double ganho = 0.04;          // % por minuto a cada mm/h
+    const double constante_min = 45.0;  // Recessão
+    double nivel = base_pct;
+    for (uint32_t i = 0; i < t->n; ++i) {
+        double min = i * dt_min;
+        double chuva = 0.0;
+        if (min >= inicio_min && min < inicio_min + duracao_min)
+            chuva = pico_mmh * sin(PI * (min - inicio_min) / duracao_min);
+        nivel += (ganho * chuva - (nivel - base_pct) / constante_min) * dt_min;
+        t->nivel[i] = saturar((nivel + gaussiano() * ruido_pct) * 100.0, 10000.0);
+        t->chuva[i] = saturar(chuva * 100.0, 65535.0);
+    }
+}
+
+static int ler_traco(traco_t *t, const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (!f) { perror(caminho); return -1; }
+    t->nome = caminho;
+    t->nivel = malloc(MAX_AMOSTRAS * sizeof(uint16_t));
+    t->chuva = malloc(MAX_AMOSTRAS * sizeof(uint16_t));
+    t->n = 0;
+    char linha[128];
+    while (t->n < MAX_AMOSTRAS && fgets(linha, sizeof(linha), f)) {
+        unsigned a, b = 0;
+        if (sscanf(linha, "%u,%u", &a, &b) < 1) continue;
+        t->nivel[t->n] = (uint16_t)a;
+        t->chuva[t->n] = (uint16_t)b;
+        t->n++;
+    }
+    fclose(f);
+    return 0;
+}
+
+static void iniciar(preditor_t *p, const config_preditor_t *cfg) {
+    switch (cfg->tipo) {
+    case PREDITOR_LINEAR:
+        preditor_iniciar_linear(p, janela, cfg->janela);
+        break;
+    case PREDITOR_HOLT:
+        preditor_iniciar_holt(p, cfg->alfa_shift, cfg->beta_shift);
+        break;
+    case PREDITOR_KALMAN:
+        preditor_iniciar_kalman(p, cfg->desvio_processo, cfg->desvio_medida);
+        break;
+    }
+}
+
+static void parametros(char *texto, size_t tamanho, const config_preditor_t *cfg) {
+    switch (cfg->tipo) {
+    case PREDITOR_LINEAR:
+        snprintf(texto, tamanho, "janela=%u", cfg->janela);
+        break;
+    case PREDITOR_HOLT:
+        snprintf(texto, tamanho, "alfa=1/%u beta=1/%u", 1u << cfg->alfa_shift, 1u << cfg->beta_shift);
+        break;
+    case PREDITOR_KALMAN:
+        snprintf(texto, tamanho, "q=%g r=%g", cfg->desvio_processo, cfg->desvio_medida);
+        break;
+    }
+}
+
+static double agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void avaliar(const traco_t *t, const config_preditor_t *cfg, uint32_t horizonte) {
+    preditor_t p;
+    double soma_abs = 0.0, soma_quad = 0.0, erro_max = 0.0;
+    uint32_t contados = 0;
+    volatile uint16_t saida = 0;
+
+    iniciar(&p, cfg);
+    for (uint32_t i = 0; i + horizonte < t->n; ++i) {
+        preditor_atualizar(&p, t->nivel[i]);
+        uint16_t previsto = preditor_prever(&p, horizonte, t->chuva[i]);
+        if (i < AQUECIMENTO) continue;
+        double erro = ((int32_t)previsto - (int32_t)t->nivel[i + horizonte]) / 100.0;
+        soma_abs += fabs(erro);
+        soma_quad += erro * erro;
+        if (fabs(erro) > erro_max) erro_max = fabs(erro);
+        contados++;
+    }
+
+    double t0 = agora_ns();
+    for (int r = 0; r < PASSADAS_TEMPO; ++r) {
+        iniciar(&p, cfg);
+        for (uint32_t i = 0; i < t->n; ++i) {
+            preditor_atualizar(&p, t->nivel[i]);
+            saida = preditor_prever(&p, horizonte, t->chuva[i]);
+        }
+    }
+    double ns = (agora_ns() - t0) / ((double)PASSADAS_TEMPO * t->n);
+    (void)saida;
+
+    char texto[48];
+    parametros(texto, sizeof(texto), cfg);
+    if (contados == 0) contados = 1;
+    printf("%s;%s;%s;%lu;%.3f;%.3f;%.3f;%.2f;%lu\n", t->nome, preditor_nome(cfg->tipo), texto,
+           (unsigned long)horizonte, soma_abs / contados, sqrt(soma_quad / contados), erro_max, ns,
+           (unsigned long)preditor_ram(&p));
+}
+
+int main(int argc, char **argv) {
+    traco_t tracos[16];
+    int n_tracos = 0;
+    uint32_t horizontes[8];
+    int n_horizontes = 0;
+
+    for (int i = 1; i < argc; ++i) {
+        if (strcmp(argv[i], "-h") == 0 && i + 1 < argc) {
+            if (n_horizontes < 8) horizontes[n_horizontes++] = (uint32_t)strtoul(argv[++i], NULL, 10);
+        } else if (n_tracos < 16 && ler_traco(&tracos[n_tracos], argv[i]) == 0) {
+            n_tracos++;
+        }
+    }
+    if (n_horizontes == 0) {
+        for (size_t h = 0; h < sizeof(horizontes_padrao) / sizeof(horizontes_padrao[0]); ++h)
+            horizontes[n_horizontes++] = horizontes_padrao[h];
+    }
+    if (n_tracos == 0) {
+        gerar_traco(&tracos[n_tracos++], "sintetico_cheia_rapida", 180, 30.0, 20.0, 25.0, 60.0, 0.5);
+        gerar_traco(&tracos[n_tracos++], "sintetico_cheia_lenta", 240, 30.0, 20.0, 90.0, 20.0, 0.5);
+        gerar_traco(&tracos[n_tracos++], "sintetico_estiagem", 120, 45.0, 0.0, 0.0, 0.0, 1.0);
+    }
+
+    printf("traco;modelo;parametros;horizonte;erro_medio_pct;erro_rms_pct;erro_max_pct;ns_por_atualizacao;ram_bytes\n");
+    for (int t = 0; t < n_tracos; ++t) {
+        for (int h = 0; h < n_horizontes; ++h) {
+            for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); ++c)
+                avaliar(&tracos[t], &configs[c], horizontes[h]);
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,177 @@
+// Benchmark de host dos filtros de fluxo (filtro.c)
+// Passa traços ruidosos por cada filtro e mede tempo por amostra e taxa de
+// alertas falsos contra o limiar de nível (70%). Sem argumentos usa traços
+// sintéticos determinísticos; com argumentos lê arquivos CSV de traços gravados,
+// uma amostra por linha: "leitura16[,referencia16]". Sem a coluna de
+// referência, ela é estimada por uma mediana centrada de 15 amostras.
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include <math.h>
+#include <time.h>
+#include "filtro.h"
+#include "sensor.h"
+
+#define MAX_AMOSTRAS 200000
+#define PASSADAS_TEMPO 20
+#define LIMIAR_ALERTA PCT_X100(70)
+#define PI 3.14159265358979323846
+
+typedef struct {
+    const char *nome;
+    uint32_t n;
+    uint16_t *leitura;      // Sinal ruidoso (escala de 16 bits)
+    uint16_t *referencia;   // Sinal limpo usado como verdade
+} traco_t;
+
+typedef struct {
+    filtro_tipo_t tipo;
+    uint8_t parametro;
+} config_filtro_t;
+
+static const config_filtro_t configs[] = {
+    {FILTRO_NENHUM, 0},
+    {FILTRO_MEDIANA, 3},
+    {FILTRO_MEDIANA, 5},
+    {FILTRO_MEDIANA, 9},
+    {FILTRO_EMA, 2},
+    {FILTRO_EMA, 3},
+    {FILTRO_MEDIA_MOVEL, 4},
+    {FILTRO_MEDIA_MOVEL, 8},
+};
+
+// Gerador determinístico (xorshift) para os traços sintéticos
+static uint32_t semente = 0x12345678u;
+static double aleatorio(void) {
+    semente ^= semente << 13;
+    semente ^= semente >> 17;
+    semente ^= semente << 5;
+    return (semente >> 8) / 16777216.0;
+}
+
+static double gaussiano(void) {
+    double u1 = aleatorio() + 1e-12, u2 = aleatorio();
+    return sqrt(-2.0 * log(u1)) * cos(2.0 * PI * u2);
+}
+
+static uint16_t saturar(double v) {
+    if (v < 0.0) return 0;
+    if (v > 65535.0) return 65535;
+    return (uint16_t)(v + 0.5);
+}
+
+// Cheia sintética: nível sobe de 40% até 78% e desce, com ruído e picos isolados
+static void gerar_traco(traco_t *t, const char *nome, uint32_t n, double ruido_pct, double prob_pico) {
+    t->nome = nome;
+    t->n = n;
+    t->leitura = malloc(n * sizeof(uint16_t));
+    t->referencia = malloc(n * sizeof(uint16_t));
+    for (uint32_t i = 0; i < n; ++i) {
+        double fase = (double)i / n;
+        double limpo = 40.0 + 38.0 * sin(PI * fase);
+        double medido = limpo + gaussiano() * ruido_pct;
+        if (aleatorio() < prob_pico) medido += (aleatorio() < 0.5 ? -1 : 1) * (25.0 + 20.0 * aleatorio());
+        t->referencia[i] = saturar(limpo * 655.35);
+        t->leitura[i] = saturar(medido * 655.35);
+    }
+}
+
+static int comparar_u16(const void *a, const void *b) {
+    return (int)*(const uint16_t *)a - (int)*(const uint16_t *)b;
+}
+
+static int ler_traco(traco_t *t, const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (!f) { perror(caminho); return -1; }
+    t->nome = caminho;
+    t->leitura = malloc(MAX_AMOSTRAS * sizeof(uint16_t));
+    t->referencia = malloc(MAX_AMOSTRAS * sizeof(uint16_t));
+    t->n = 0;
+    bool com_referencia = true;
+    char linha[128];
+    while (t->n < MAX_AMOSTRAS && fgets(linha, sizeof(linha), f)) {
+        unsigned a, b;
+        int campos = sscanf(linha, "%u,%u", &a, &b);
+        if (campos < 1) continue;
+        t->leitura[t->n] = (uint16_t)a;
+        if (campos == 2) t->referencia[t->n] = (uint16_t)b;
+        else com_referencia = false;
+        t->n++;
+    }
+    fclose(f);
+    if (!com_referencia) {
+        for (uint32_t i = 0; i < t->n; ++i) {
+            uint16_t janela[15];
+            int k = 0;
+            for (int d = -7; d <= 7; ++d) {
+                int64_t j = (int64_t)i + d;
+                if (j < 0) j = 0;
+                if (j >= t->n) j = t->n - 1;
+                janela[k++] = t->leitura[j];
+            }
+            qsort(janela, 15, sizeof(uint16_t), comparar_u16);
+            t->referencia[i] = janela[7];
+        }
+    }
+    return 0;
+}
+
+static double agora_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void avaliar(const traco_t *t, const config_filtro_t *cfg) {
+    filtro_t f;
+    uint32_t falsos = 0, eventos_falsos = 0, perdidos = 0;
+    bool alerta_anterior = false;
+    volatile uint16_t saida = 0;
+
+    filtro_iniciar(&f, cfg->tipo, cfg->parametro);
+    for (uint32_t i = 0; i < t->n; ++i) {
+        uint16_t y = filtro_atualizar(&f, t->leitura[i]);
+        bool alerta = sensor_percentual_x100(y) >= LIMIAR_ALERTA;
+        bool verdade = sensor_percentual_x100(t->referencia[i]) >= LIMIAR_ALERTA;
+        if (alerta && !verdade) {
+            falsos++;
+            if (!alerta_anterior) eventos_falsos++;
+        }
+        if (!alerta && verdade) perdidos++;
+        alerta_anterior = alerta;
+    }
+
+    double t0 = agora_ns();
+    for (int p = 0; p < PASSADAS_TEMPO; ++p) {
+        filtro_iniciar(&f, cfg->tipo, cfg->parametro);
+        for (uint32_t i = 0; i < t->n; ++i) saida = filtro_atualizar(&f, t->leitura[i]);
+    }
+    double ns = (agora_ns() - t0) / ((double)PASSADAS_TEMPO * t->n);
+    (void)saida;
+
+    printf("%s;%s;%u;%.2f;%.3f;%u;%.3f\n", t->nome, filtro_nome(cfg->tipo), cfg->parametro, ns,
+           100.0 * falsos / t->n, eventos_falsos, 100.0 * perdidos / t->n);
+}
+
+int main(int argc, char **argv) {
+    traco_t tracos[16];
+    int n_tracos = 0;
+
+    if (argc > 1) {
+        for (int i = 1; i < argc && n_tracos < 16; ++i) {
+            if (ler_traco(&tracos[n_tracos], argv[i]) == 0) n_tracos++;
+        }
+    } else {
+        gerar_traco(&tracos[n_tracos++], "sintetico_ruido_baixo", 20000, 1.0, 0.002);
+        gerar_traco(&tracos[n_tracos++], "sintetico_ruido_alto", 20000, 3.0, 0.002);
+        gerar_traco(&tracos[n_tracos++], "sintetico_picos", 20000, 1.0, 0.02);
+    }
+
+    printf("traco;filtro;parametro;ns_por_amostra;alerta_falso_pct;eventos_falsos;alerta_perdido_pct\n");
+    for (int t = 0; t < n_tracos; ++t) {
+        for (size_t c = 0; c < sizeof(configs) / sizeof(configs[0]); ++c) avaliar(&tracos[t], &configs[c]);
+    }
+    return 0;
+}
@@ -0,0 +1,15 @@
+// Benchmark de host das saídas: os mesmos casos de bench/bench_display.c,
+// bench/bench_formato.c e bench/bench_matriz.c, compilados com BENCH_HOST sobre a HAL de hal_host.c
+// Sem barramento real, a coluna ns é só CPU; os bytes são os mesmos do alvo
+#include "bench.h"
+
+int main(void) {
+    printf(BENCH_CABECALHO_CUSTO "\n");
+    bench_display();
+    bench_formato();
+
+    printf(BENCH_CABECALHO_SAIDAS "\n");
+    bench_display_saidas();
+    bench_matriz();
+    return 0;
+}
@@ -0,0 +1,131 @@
+// HAL mínima para os benchmarks de saída no host
+// Implementa, sobre os cabeçalhos de sim/hal, só o que ssd1306.c e
+// matriz_led.c usam. Nada vai a um barramento: o I2C aceita os bytes na hora,
+// o DMA (display e matriz) termina na própria chamada, com a IRQ entregue em
+// seguida, e as pausas (sleep_us/sleep_ms) avançam um relógio virtual em vez
+// de dormir, de modo que as medidas são só de CPU
+#include <time.h>
+#include "pico/stdlib.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+
+#define HOST_IRQS 32
+#define HOST_HANDLERS_POR_IRQ 4
+
+i2c_inst_t sim_i2c0_inst, sim_i2c1_inst;
+static dma_hw_t dma_registradores;
+dma_hw_t *dma_hw = &dma_registradores;
+static pio_hw_t pio0_registradores;
+pio_hw_t *const sim_pio0 = &pio0_registradores;
+
+static irq_handler_t handlers[HOST_IRQS][HOST_HANDLERS_POR_IRQ];
+static bool dma_irq1[SIM_DMA_CANAIS];
+static int dma_proximo_livre = 0;
+static uint64_t pausa_us = 0;           // Tempo virtual acumulado pelas pausas
+
+/* ---------- Tempo ---------- */
+uint64_t time_us_64(void) {
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint64_t)t.tv_sec * 1000000u + (uint64_t)t.tv_nsec / 1000 + pausa_us;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+absolute_time_t get_absolute_time(void) {
+    return time_us_64();
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t) {
+    return (uint32_t)(t / 1000);
+}
+
+uint64_t to_us_since_boot(absolute_time_t t) {
+    return t;
+}
+
+void sleep_us(uint64_t us) {
+    pausa_us += us;
+}
+
+void sleep_ms(uint32_t ms) {
+    pausa_us += (uint64_t)ms * 1000;
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    (void)clk_index;
+    return 125000000;
+}
+
+bool stdio_init_all(void) {
+    return true;
+}
+
+/* ---------- GPIO ---------- */
+void gpio_set_function(uint gpio, enum gpio_function fn) { (void)gpio; (void)fn; }
+void gpio_pull_up(uint gpio) { (void)gpio; }
+
+/* ---------- I2C ---------- */
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    i2c->baudrate = baudrate;
+    i2c->hw.status = I2C_IC_STATUS_TFE_BITS;
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)i2c; (void)addr; (void)src; (void)nostop;
+    return (int)len;
+}
+
+/* ---------- DMA e IRQ ---------- */
+int dma_claim_unused_channel(bool required) {
+    (void)required;
+    return dma_proximo_livre < SIM_DMA_CANAIS ? dma_proximo_livre++ : -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    dma_channel_config c = {0};
+    return c;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    (void)channel; (void)config; (void)write_addr; (void)read_addr; (void)transfer_count; (void)trigger;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) { (void)channel; (void)enabled; }
+
+void dma_channel_set_irq1_enabled(uint channel, bool enabled) {
+    dma_irq1[channel] = enabled;
+}
+
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+    (void)read_addr; (void)transfer_count;
+    if (!dma_irq1[channel]) return;
+    dma_hw->ints1 |= 1u << channel;
+    for (int i = 0; i < HOST_HANDLERS_POR_IRQ; ++i) {
+        if (handlers[DMA_IRQ_1][i]) handlers[DMA_IRQ_1][i]();
+    }
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+    handlers[num][0] = handler;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+    (void)order_priority;
+    for (int i = 0; i < HOST_HANDLERS_POR_IRQ; ++i) {
+        if (handlers[num][i] == NULL || handlers[num][i] == handler) {
+            handlers[num][i] = handler;
+            return;
+        }
+    }
+}
+
+void irq_set_enabled(uint num, bool enabled) { (void)num; (void)enabled; }
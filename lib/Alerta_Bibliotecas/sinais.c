@@ -0,0 +1,131 @@
+#include "sinais.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+
+#define BUZZER_DIVISOR 125.0f           // 125 MHz / 125 = contador de 1 MHz
+#define BUZZER_CONTADOR_HZ 1000000u
+#define BUZZER_FATOR_CICLO 15           // Nível = período / 15: ciclo de trabalho reduzido
+
+/* ---------- Padrões ---------- */
+static const sinal_passo_t passos_desligado[] = {{0, 0}};
+static const sinal_passo_t passos_ligado[] = {{1, 0}};
+static const sinal_passo_t passos_pisca_lento[] = {{1, 500}, {0, 500}};
+static const sinal_passo_t passos_tom_prioritario[] = {{1000, 1000}, {0, 500}};
+static const sinal_passo_t passos_tom_chuva[] = {{1000, 150}, {0, 150}, {1000, 150}, {0, 150}};
+static const sinal_passo_t passos_tom_nivel[] = {{1000, 200}, {0, 200}};
+
+const sinal_padrao_t SINAL_DESLIGADO = {passos_desligado, count_of(passos_desligado), false};
+const sinal_padrao_t SINAL_LIGADO = {passos_ligado, count_of(passos_ligado), false};
+const sinal_padrao_t SINAL_PISCA_LENTO = {passos_pisca_lento, count_of(passos_pisca_lento), true};
+const sinal_padrao_t SINAL_TOM_PRIORITARIO = {passos_tom_prioritario, count_of(passos_tom_prioritario), true};
+const sinal_padrao_t SINAL_TOM_CHUVA = {passos_tom_chuva, count_of(passos_tom_chuva), true};
+const sinal_padrao_t SINAL_TOM_NIVEL = {passos_tom_nivel, count_of(passos_tom_nivel), true};
+
+/* ---------- Estado ---------- */
+typedef struct {
+    sinal_saida_t saida;
+    const sinal_padrao_t *atual;
+    uint16_t indice;
+    alarm_id_t alarme;                  // Alarme do próximo passo (0 = parada em um passo)
+} sinal_estado_t;
+
+// Compartilhado entre sinais_tocar (tarefas) e avancar (IRQ do alarme,
+// possivelmente no outro núcleo)
+static spin_lock_t *trava;
+static sinal_estado_t estados[SINAL_SAIDAS];
+static uint pinos[SINAL_SAIDAS];
+static uint buzzer_fatia, buzzer_canal;
+static uint16_t buzzer_hz = 0;          // Frequência do período programado no PWM
+
+// Só escreve registradores: segura a trava por poucos ciclos
+static void aplicar(sinal_saida_t saida, uint16_t valor) {
+    if (saida != SINAL_BUZZER) {
+        gpio_put(pinos[saida], valor != 0);
+        return;
+    }
+    if (valor == 0) {
+        pwm_set_chan_level(buzzer_fatia, buzzer_canal, 0);
+        return;
+    }
+    uint32_t top = BUZZER_CONTADOR_HZ / valor - 1;
+    if (valor != buzzer_hz) {
+        pwm_set_wrap(buzzer_fatia, (uint16_t)top);
+        buzzer_hz = valor;
+    }
+    pwm_set_chan_level(buzzer_fatia, buzzer_canal, (uint16_t)(top / BUZZER_FATOR_CICLO));
+}
+
+// Aplica o próximo passo; o retorno agenda o seguinte (ver alarm_callback_t)
+static int64_t avancar(alarm_id_t id, void *dados) {
+    sinal_estado_t *e = dados;
+    int64_t proximo = 0;
+    uint32_t salvo = spin_lock_blocking(trava);
+    if (id != e->alarme) {
+        // Alarme de um padrão que já foi trocado
+        spin_unlock(trava, salvo);
+        return 0;
+    }
+
+    if (e->indice + 1 == e->atual->n && !e->atual->repetir) {
+        e->alarme = 0;                                  // Fica no último passo
+    } else {
+        e->indice = (e->indice + 1) % e->atual->n;
+        const sinal_passo_t *p = &e->atual->passos[e->indice];
+        aplicar(e->saida, p->valor);
+        if (p->duracao_ms == 0) e->alarme = 0;
+        else proximo = -(int64_t)p->duracao_ms * 1000;  // A partir do instante previsto deste passo
+    }
+    spin_unlock(trava, salvo);
+    return proximo;
+}
+
+void sinais_iniciar(uint pino_buzzer, uint pino_vermelho, uint pino_verde) {
+    trava = spin_lock_instance(spin_lock_claim_unused(true));
+    pinos[SINAL_BUZZER] = pino_buzzer;
+    pinos[SINAL_LED_VERMELHO] = pino_vermelho;
+    pinos[SINAL_LED_VERDE] = pino_verde;
+
+    for (int i = 0; i < SINAL_SAIDAS; ++i) {
+        estados[i].saida = (sinal_saida_t)i;
+        estados[i].atual = &SINAL_DESLIGADO;
+        estados[i].indice = 0;
+        estados[i].alarme = 0;
+    }
+
+    gpio_init(pino_vermelho);
+    gpio_set_dir(pino_vermelho, GPIO_OUT);
+    gpio_put(pino_vermelho, 0);
+    gpio_init(pino_verde);
+    gpio_set_dir(pino_verde, GPIO_OUT);
+    gpio_put(pino_verde, 0);
+
+    // O PWM fica sempre ligado; silêncio é nível 0
+    buzzer_fatia = pwm_gpio_to_slice_num(pino_buzzer);
+    buzzer_canal = pwm_gpio_to_channel(pino_buzzer);
+    pwm_set_clkdiv(buzzer_fatia, BUZZER_DIVISOR);
+    pwm_set_chan_level(buzzer_fatia, buzzer_canal, 0);
+    gpio_set_function(pino_buzzer, GPIO_FUNC_PWM);
+    pwm_set_enabled(buzzer_fatia, true);
+}
+
+void sinais_tocar(sinal_saida_t saida, const sinal_padrao_t *padrao) {
+    sinal_estado_t *e = &estados[saida];
+    uint32_t salvo = spin_lock_blocking(trava);
+    if (padrao == e->atual && e->alarme >= 0) {
+        spin_unlock(trava, salvo);
+        return;
+    }
+    alarm_id_t anterior = e->alarme;
+    e->atual = padrao;
+    e->indice = 0;
+    aplicar(saida, padrao->passos[0].valor);
+    uint16_t duracao_ms = padrao->passos[0].duracao_ms;
+    bool continua = padrao->n > 1 || padrao->repetir;
+    // Nunca no passado: com fire_if_past, a callback rodaria aqui dentro, com a trava tomada
+    e->alarme = duracao_ms != 0 && continua
+              ? add_alarm_in_us((uint64_t)duracao_ms * 1000, avancar, e, false) : 0;
+    spin_unlock(trava, salvo);
+
+    // Se o alarme antigo já estiver na callback, ela vê o id trocado e não se reagenda
+    if (anterior > 0) cancel_alarm(anterior);
+}
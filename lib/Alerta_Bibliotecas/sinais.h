@@ -0,0 +1,48 @@
+#ifndef SINAIS_H
+#define SINAIS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/* ---------- Sinais de alerta: buzzer e LEDs indicadores ----------
+ * Cada saída toca um padrão, tabela constante (em flash) de passos com
+ * duração própria. O primeiro passo é aplicado na própria chamada de
+ * sinais_tocar; os seguintes, por um alarme de hardware, então nenhuma
+ * tarefa bloqueia e um padrão novo substitui o atual na hora.
+ * O tom do buzzer é o PWM configurado uma vez em sinais_iniciar: cada passo
+ * só troca o período e o nível do canal.
+ */
+typedef enum {
+    SINAL_BUZZER,
+    SINAL_LED_VERMELHO,
+    SINAL_LED_VERDE,
+    SINAL_SAIDAS
+} sinal_saida_t;
+
+typedef struct {
+    uint16_t valor;           // Buzzer: frequência em Hz (0 = silêncio); LEDs: 0 ou 1
+    uint16_t duracao_ms;      // 0: fica neste passo até outro padrão
+} sinal_passo_t;
+
+typedef struct {
+    const sinal_passo_t *passos;
+    uint16_t n;
+    bool repetir;             // Volta ao primeiro passo depois do último
+} sinal_padrao_t;
+
+/* ---------- Padrões das tarefas de alerta ---------- */
+extern const sinal_padrao_t SINAL_DESLIGADO;         // Qualquer saída: apagada/silenciosa
+extern const sinal_padrao_t SINAL_LIGADO;            // LEDs: aceso
+extern const sinal_padrao_t SINAL_PISCA_LENTO;       // LEDs: 500 ms aceso, 500 ms apagado
+extern const sinal_padrao_t SINAL_TOM_PRIORITARIO;   // Buzzer: 1 s de tom, 500 ms de pausa
+extern const sinal_padrao_t SINAL_TOM_CHUVA;         // Buzzer: dois beeps de 150 ms
+extern const sinal_padrao_t SINAL_TOM_NIVEL;         // Buzzer: beep intermitente de 200 ms
+
+// Configura o PWM do buzzer e os pinos dos LEDs, todos desligados
+void sinais_iniciar(uint pino_buzzer, uint pino_vermelho, uint pino_verde);
+
+// Troca o padrão de uma saída; se ele já estiver tocando, segue de onde está
+void sinais_tocar(sinal_saida_t saida, const sinal_padrao_t *padrao);
+
+#endif /* SINAIS_H */
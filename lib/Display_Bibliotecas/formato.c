@@ -0,0 +1,35 @@
+#include "formato.h"
+
+uint8_t formato_fixo(char *destino, uint8_t tamanho, int32_t valor, uint8_t decimais, const char *sufixo) {
+    char digitos[10];               // 2^31 tem 10 dígitos
+    uint8_t n = 0, i = 0;
+    uint32_t resto = valor < 0 ? 0u - (uint32_t)valor : (uint32_t)valor;
+
+    if (tamanho == 0) return 0;
+    if (decimais > FORMATO_DECIMAIS_MAX) decimais = FORMATO_DECIMAIS_MAX;
+
+    // Dígitos do menos significativo para o mais, com zeros até a unidade ("0.05")
+    do {
+        digitos[n++] = (char)('0' + resto % 10);
+        resto /= 10;
+    } while ((resto != 0 || n <= decimais) && n < sizeof(digitos));
+
+    if (valor < 0 && i + 1 < tamanho) destino[i++] = '-';
+    while (n > 0 && i + 1 < tamanho) {
+        if (n == decimais) {
+            destino[i++] = '.';
+            if (i + 1 >= tamanho) break;
+        }
+        destino[i++] = digitos[--n];
+    }
+    while (sufixo != NULL && *sufixo && i + 1 < tamanho) destino[i++] = *sufixo++;
+    destino[i] = '\0';
+    return i;
+}
+
+void formato_desenhar_fixo(ssd1306_t *ssd, int32_t valor, uint8_t decimais, const char *sufixo,
+                           uint8_t x, uint8_t y, bool use_small_numbers) {
+    char texto[FORMATO_TAMANHO_MAX];
+    formato_fixo(texto, sizeof(texto), valor, decimais, sufixo);
+    ssd1306_draw_string(ssd, texto, x, y, use_small_numbers);
+}
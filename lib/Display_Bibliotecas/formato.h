@@ -0,0 +1,29 @@
+// formato.h
+// Números inteiros e em ponto fixo como texto, sem printf, varargs nem float
+#ifndef FORMATO_H
+#define FORMATO_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+#define FORMATO_TAMANHO_MAX 16      // Maior texto de formato_desenhar_fixo, com sufixo e '\0'
+#define FORMATO_DECIMAIS_MAX 9      // Um int32 tem até 10 dígitos: sempre sobra o "0" antes do ponto
+
+// Escreve valor / 10^decimais com exatamente 'decimais' casas e o sufixo
+// (ex.: 1234, 2, "mm" -> "12.34mm"; -5, 1, "%" -> "-0.5%"). decimais acima
+// de FORMATO_DECIMAIS_MAX vira FORMATO_DECIMAIS_MAX. Como o snprintf,
+// trunca no tamanho do destino e sempre termina com '\0'; devolve o
+// comprimento escrito, sem o '\0'
+uint8_t formato_fixo(char *destino, uint8_t tamanho, int32_t valor, uint8_t decimais, const char *sufixo);
+
+// formato_fixo sem casas decimais
+static inline uint8_t formato_inteiro(char *destino, uint8_t tamanho, int32_t valor, const char *sufixo) {
+    return formato_fixo(destino, tamanho, valor, 0, sufixo);
+}
+
+// Formata e desenha direto no buffer do display, como ssd1306_draw_string
+void formato_desenhar_fixo(ssd1306_t *ssd, int32_t valor, uint8_t decimais, const char *sufixo,
+                           uint8_t x, uint8_t y, bool use_small_numbers);
+
+#endif /* FORMATO_H */
@@ -1,8 +1,37 @@
 #include "ssd1306.h"
-#include "font.h"
+#include "generated/font_colunas.h"
 #include <stdlib.h>
+#include <string.h>
 #include <math.h>
 #include "hardware/i2c.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+
+// Palavras por página no stream de TX: 7 de comando, 1 prefixo e os dados
+#define SSD1306_STREAM_OVERHEAD 8
+
+static ssd1306_t *dma_owner = NULL; // Instância servida pela IRQ do DMA
+
+#ifndef MODO_ESTATICO
+#define MODO_ESTATICO 0
+#endif
+
+#if MODO_ESTATICO
+// Buffers da única instância (a IRQ do DMA já serve uma só), reservados no link
+#define SSD1306_BUFSIZE_MAX (SSD1306_WIDTH_MAX * SSD1306_HEIGHT_MAX / 8 + 1)
+static uint8_t ram_buffer_estatico[SSD1306_BUFSIZE_MAX];
+static uint8_t shadow_buffer_estatico[SSD1306_BUFSIZE_MAX - 1];
+static uint16_t tx_stream_estatico[SSD1306_HEIGHT_MAX / 8 * (SSD1306_WIDTH_MAX + SSD1306_STREAM_OVERHEAD)];
+#endif
+
+// Fim da transferência DMA: o último byte (com STOP) já está no FIFO de TX
+static void ssd1306_dma_irq_handler(void) {
+    ssd1306_t *ssd = dma_owner;
+    if (ssd == NULL || !(dma_hw->ints1 & (1u << ssd->dma_chan))) return;
+    dma_hw->ints1 = 1u << ssd->dma_chan;
+    ssd->flush_busy = false;
+    if (ssd->flush_cb) ssd->flush_cb(ssd->flush_ctx);
+}
 
 // Inicializa a estrutura do display SSD1306
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_vcc, uint8_t address, i2c_inst_t *i2c) {
@@ -12,17 +41,62 @@ void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height, bool external_v
     ssd->address = address;
     ssd->i2c_port = i2c;
     ssd->bufsize = ssd->pages * ssd->width + 1;
-    
+
+#if MODO_ESTATICO
+    // Display maior que o reservado ou segunda instância: erro de configuração, pego já no boot
+    if (width > SSD1306_WIDTH_MAX || height > SSD1306_HEIGHT_MAX || dma_owner != NULL) {
+        while (1);
+    }
+    ssd->ram_buffer = ram_buffer_estatico;
+    ssd->shadow_buffer = shadow_buffer_estatico;
+    ssd->tx_stream = tx_stream_estatico;        // Zerados como o calloc: estão no .bss
+#else
     // Aloca buffer de dados
     ssd->ram_buffer = calloc(ssd->bufsize, sizeof(uint8_t));
     if (ssd->ram_buffer == NULL) {
         // Em caso de falha, poderia adicionar tratamento de erro (ex.: log ou loop infinito)
         while (1);
     }
+
+    // Aloca a cópia sombra do conteúdo já enviado ao display
+    ssd->shadow_buffer = calloc(ssd->bufsize - 1, sizeof(uint8_t));
+    if (ssd->shadow_buffer == NULL) {
+        while (1);
+    }
+
+    // Stream de TX para o DMA (pior caso: todas as páginas com janela completa)
+    ssd->tx_stream = calloc(ssd->pages * (ssd->width + SSD1306_STREAM_OVERHEAD), sizeof(uint16_t));
+    if (ssd->tx_stream == NULL) {
+        while (1);
+    }
+#endif
     
     // Inicializa buffers
     ssd->ram_buffer[0] = 0x40; // Prefixo de dados
     ssd->port_buffer[0] = 0x00; // Prefixo de comando (Co=0, D/C=0)
+
+    // Conteúdo da GDDRAM é desconhecido após o reset: primeiro flush é completo
+    ssd->full_refresh = true;
+    ssd->bytes_last_flush = 0;
+    ssd->bytes_total = 0;
+    ssd->flush_count = 0;
+    ssd->flush_busy = false;
+    ssd->flush_cb = NULL;
+    ssd->flush_ctx = NULL;
+
+    // Canal DMA pacificado pelo DREQ de TX do I2C, escrevendo em IC_DATA_CMD
+    ssd->dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(ssd->dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, i2c_get_dreq(i2c, true));
+    dma_channel_configure(ssd->dma_chan, &c, &i2c_get_hw(i2c)->data_cmd, ssd->tx_stream, 0, false);
+
+    dma_owner = ssd;
+    dma_channel_set_irq1_enabled(ssd->dma_chan, true);
+    irq_add_shared_handler(DMA_IRQ_1, ssd1306_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_1, true);
 }
 
 // Configura os parâmetros iniciais do display
@@ -56,110 +130,273 @@ void ssd1306_config(ssd1306_t *ssd) {
 
 // Envia um comando para o display via I2C
 void ssd1306_command(ssd1306_t *ssd, uint8_t command) {
+    ssd1306_wait_flush(ssd); // Não intercala com um flush assíncrono
     ssd->port_buffer[1] = command;
     i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->port_buffer, 2, false);
 }
 
+// Liga o painel ou o coloca em modo sleep (0xAE); a GDDRAM é preservada,
+// então a cópia sombra continua válida ao religar
+void ssd1306_set_power(ssd1306_t *ssd, bool on) {
+    ssd1306_command(ssd, on ? 0xAF : 0xAE);
+}
+
+// Ajusta o contraste (0x00-0xFF); valores baixos reduzem a corrente do painel
+void ssd1306_set_contrast(ssd1306_t *ssd, uint8_t contrast) {
+    ssd1306_command(ssd, 0x81);
+    ssd1306_command(ssd, contrast);
+}
+
 // Envia o buffer de dados para o display
+// Compara cada página com a cópia sombra e transmite apenas a janela de
+// colunas alterada, usando o endereçamento 0x21/0x22 para posicioná-la
 void ssd1306_send_data(ssd1306_t *ssd) {
-    ssd1306_command(ssd, 0x21); // Define endereço de coluna
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->width - 1);
-    ssd1306_command(ssd, 0x22); // Define endereço de página
-    ssd1306_command(ssd, 0);
-    ssd1306_command(ssd, ssd->pages - 1);
-    i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false);
+    uint32_t bytes = 0;
+
+    ssd1306_wait_flush(ssd);
+
+    if (ssd->full_refresh) {
+        ssd1306_command(ssd, 0x21); // Define endereço de coluna
+        ssd1306_command(ssd, 0);
+        ssd1306_command(ssd, ssd->width - 1);
+        ssd1306_command(ssd, 0x22); // Define endereço de página
+        ssd1306_command(ssd, 0);
+        ssd1306_command(ssd, ssd->pages - 1);
+        i2c_write_blocking(ssd->i2c_port, ssd->address, ssd->ram_buffer, ssd->bufsize, false);
+        memcpy(ssd->shadow_buffer, &ssd->ram_buffer[1], ssd->bufsize - 1);
+        bytes = 6 * 2 + ssd->bufsize;
+        ssd->full_refresh = false;
+    } else {
+        for (uint8_t page = 0; page < ssd->pages; ++page) {
+            uint8_t *linha = &ssd->ram_buffer[page * ssd->width + 1];
+            uint8_t *sombra = &ssd->shadow_buffer[page * ssd->width];
+
+            // Procura a primeira e a última coluna alteradas na página
+            uint8_t x0 = 0;
+            while (x0 < ssd->width && linha[x0] == sombra[x0]) ++x0;
+            if (x0 == ssd->width) continue; // Página sem alterações
+            uint8_t x1 = ssd->width - 1;
+            while (linha[x1] == sombra[x1]) --x1;
+            uint16_t n = x1 - x0 + 1;
+
+            ssd1306_command(ssd, 0x21); // Janela de colunas
+            ssd1306_command(ssd, x0);
+            ssd1306_command(ssd, x1);
+            ssd1306_command(ssd, 0x22); // Página única
+            ssd1306_command(ssd, page);
+            ssd1306_command(ssd, page);
+
+            // O byte anterior à janela recebe temporariamente o prefixo de dados
+            uint8_t *inicio = linha + x0 - 1;
+            uint8_t salvo = *inicio;
+            *inicio = 0x40;
+            i2c_write_blocking(ssd->i2c_port, ssd->address, inicio, n + 1, false);
+            *inicio = salvo;
+
+            memcpy(sombra + x0, linha + x0, n);
+            bytes += 6 * 2 + n + 1;
+        }
+    }
+
+    ssd->bytes_last_flush = bytes;
+    ssd->bytes_total += bytes;
+    ssd->flush_count++;
+}
+
+// Acrescenta ao stream uma janela (colunas x0..x1, páginas p0..p1) e seus dados
+static uint32_t ssd1306_stream_window(ssd1306_t *ssd, uint32_t n, uint8_t x0, uint8_t x1,
+                                      uint8_t p0, uint8_t p1, const uint8_t *dados, uint16_t len) {
+    uint16_t *s = ssd->tx_stream;
+    s[n++] = 0x00; // Prefixo de comando (Co=0, D/C=0)
+    s[n++] = 0x21;
+    s[n++] = x0;
+    s[n++] = x1;
+    s[n++] = 0x22;
+    s[n++] = p0;
+    s[n++] = p1 | I2C_IC_DATA_CMD_STOP_BITS;
+    s[n++] = 0x40; // Prefixo de dados
+    for (uint16_t i = 0; i < len; ++i) s[n++] = dados[i];
+    s[n - 1] |= I2C_IC_DATA_CMD_STOP_BITS;
+    return n;
+}
+
+// Envia o buffer de dados sem bloquear
+// Monta o stream das janelas alteradas (mesma lógica de ssd1306_send_data) e o
+// entrega ao DMA. O framebuffer fica livre para o próximo quadro assim que a
+// função retorna. Retorna false se o flush anterior ainda estiver em andamento;
+// nesse caso nada é perdido, pois a cópia sombra não foi atualizada
+bool ssd1306_send_data_async(ssd1306_t *ssd) {
+    if (ssd->flush_busy) return false;
+
+    uint32_t n = 0;
+    if (ssd->full_refresh) {
+        n = ssd1306_stream_window(ssd, n, 0, ssd->width - 1, 0, ssd->pages - 1,
+                                  &ssd->ram_buffer[1], ssd->bufsize - 1);
+        memcpy(ssd->shadow_buffer, &ssd->ram_buffer[1], ssd->bufsize - 1);
+        ssd->full_refresh = false;
+    } else {
+        for (uint8_t page = 0; page < ssd->pages; ++page) {
+            uint8_t *linha = &ssd->ram_buffer[page * ssd->width + 1];
+            uint8_t *sombra = &ssd->shadow_buffer[page * ssd->width];
+
+            uint8_t x0 = 0;
+            while (x0 < ssd->width && linha[x0] == sombra[x0]) ++x0;
+            if (x0 == ssd->width) continue;
+            uint8_t x1 = ssd->width - 1;
+            while (linha[x1] == sombra[x1]) --x1;
+            uint16_t len = x1 - x0 + 1;
+
+            n = ssd1306_stream_window(ssd, n, x0, x1, page, page, linha + x0, len);
+            memcpy(sombra + x0, linha + x0, len);
+        }
+    }
+
+    ssd->bytes_last_flush = n;
+    ssd->bytes_total += n;
+    ssd->flush_count++;
+    if (n == 0) return true; // Nada mudou: nenhum byte no barramento
+
+    i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+    if (hw->tar != ssd->address) {
+        hw->enable = 0;
+        hw->tar = ssd->address;
+        hw->enable = 1;
+    }
+    (void)hw->clr_tx_abrt; // Libera o FIFO caso um NACK anterior o tenha travado
+
+    ssd->flush_busy = true;
+    dma_channel_transfer_from_buffer_now(ssd->dma_chan, ssd->tx_stream, n);
+    return true;
+}
+
+// Indica se ainda há um flush assíncrono em andamento
+bool ssd1306_flush_busy(ssd1306_t *ssd) {
+    return ssd->flush_busy;
+}
+
+// Aguarda o fim do flush assíncrono e o esvaziamento do FIFO de TX
+void ssd1306_wait_flush(ssd1306_t *ssd) {
+    i2c_hw_t *hw = i2c_get_hw(ssd->i2c_port);
+    while (ssd->flush_busy) tight_loop_contents();
+    while (!(hw->status & I2C_IC_STATUS_TFE_BITS) || (hw->status & I2C_IC_STATUS_MST_ACTIVITY_BITS)) {
+        tight_loop_contents();
+    }
+}
+
+// Registra o callback de fim de flush (executado na IRQ do DMA)
+void ssd1306_set_flush_callback(ssd1306_t *ssd, ssd1306_flush_cb_t cb, void *ctx) {
+    ssd->flush_ctx = ctx;
+    ssd->flush_cb = cb;
+}
+
+// Descarta a cópia sombra, forçando o envio completo no próximo flush
+void ssd1306_invalidate(ssd1306_t *ssd) {
+    ssd->full_refresh = true;
+}
+
+// Copia o framebuffer atual para uma camada (pages * width bytes)
+void ssd1306_save_layer(ssd1306_t *ssd, uint8_t *layer) {
+    memcpy(layer, &ssd->ram_buffer[1], ssd->bufsize - 1);
+}
+
+// Substitui o framebuffer pelo conteúdo de uma camada salva
+void ssd1306_load_layer(ssd1306_t *ssd, const uint8_t *layer) {
+    memcpy(&ssd->ram_buffer[1], layer, ssd->bufsize - 1);
 }
 
 // Desenha um pixel no buffer
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value) {
     if (x >= ssd->width || y >= ssd->height) return; // Verifica limites
-    uint16_t index = (y / 8) * ssd->width + x + 1;
-    uint8_t pixel = y % 8;
+    uint16_t index = (y >> 3) * ssd->width + x + 1;
+    uint8_t mask = 1u << (y & 7);
     if (value) {
-        ssd->ram_buffer[index] |= (1 << pixel);
+        ssd->ram_buffer[index] |= mask;
     } else {
-        ssd->ram_buffer[index] &= ~(1 << pixel);
+        ssd->ram_buffer[index] &= ~mask;
+    }
+}
+
+// Máscara dos bits de uma página cobertos pelas linhas y0..y1 (0 a 7, y0 <= y1)
+static inline uint8_t ssd1306_page_mask(uint8_t y0, uint8_t y1) {
+    return (uint8_t)((0xFFu << y0) & (0xFFu >> (7 - y1)));
+}
+
+// Aplica a máscara a um trecho contínuo de colunas de uma página
+static inline void ssd1306_span(uint8_t *p, uint8_t n, uint8_t mask, bool value) {
+    if (mask == 0xFF) {
+        memset(p, value ? 0xFF : 0x00, n);
+    } else if (value) {
+        while (n--) *p++ |= mask;
+    } else {
+        mask = ~mask;
+        while (n--) *p++ &= mask;
+    }
+}
+
+// Preenche o retângulo [x0..x1] x [y0..y1] já recortado, página por página
+static void ssd1306_fill_area(ssd1306_t *ssd, uint8_t x0, uint8_t x1,
+                              uint8_t y0, uint8_t y1, bool value) {
+    uint8_t n = x1 - x0 + 1;
+    uint8_t page0 = y0 >> 3, page1 = y1 >> 3;
+    uint8_t *p = &ssd->ram_buffer[page0 * ssd->width + x0 + 1];
+    for (uint8_t page = page0; page <= page1; ++page, p += ssd->width) {
+        uint8_t lo = (page == page0) ? (y0 & 7) : 0;
+        uint8_t hi = (page == page1) ? (y1 & 7) : 7;
+        ssd1306_span(p, n, ssd1306_page_mask(lo, hi), value);
     }
 }
 
 // Preenche a tela com pixels ligados ou desligados
 void ssd1306_fill(ssd1306_t *ssd, bool value) {
-    for (uint8_t y = 0; y < ssd->height; ++y) {
-        for (uint8_t x = 0; x < ssd->width; ++x) {
-            ssd1306_pixel(ssd, x, y, value);
-        }
+    memset(&ssd->ram_buffer[1], value ? 0xFF : 0x00, ssd->bufsize - 1);
+}
+
+// Copia um glifo em colunas para o buffer a partir de (x, y)
+// Com y múltiplo de 8 cada coluna é um único byte; fora disso a coluna se
+// divide entre duas páginas com um deslocamento. 'mask' indica as linhas que
+// o glifo ocupa; no modo opaco essas linhas são apagadas antes do OR
+static void ssd1306_blit(ssd1306_t *ssd, const uint8_t *colunas, uint8_t largura,
+                         uint8_t mask, uint8_t x, uint8_t y, bool opaco) {
+    if (x >= ssd->width || y >= ssd->height) return;
+    if (largura > ssd->width - x) largura = ssd->width - x;
+
+    uint8_t page = y >> 3, shift = y & 7;
+    uint8_t *p = &ssd->ram_buffer[page * ssd->width + x + 1];
+    uint8_t mask_lo = mask << shift;
+
+    if (opaco) {
+        for (uint8_t i = 0; i < largura; ++i) p[i] = (p[i] & ~mask_lo) | (uint8_t)(colunas[i] << shift);
+    } else {
+        for (uint8_t i = 0; i < largura; ++i) p[i] |= (uint8_t)(colunas[i] << shift);
+    }
+
+    uint8_t mask_hi = shift ? (mask >> (8 - shift)) : 0;
+    if (mask_hi == 0 || page + 1 >= ssd->pages) return;
+    p += ssd->width;
+    if (opaco) {
+        for (uint8_t i = 0; i < largura; ++i) p[i] = (p[i] & ~mask_hi) | (colunas[i] >> (8 - shift));
+    } else {
+        for (uint8_t i = 0; i < largura; ++i) p[i] |= colunas[i] >> (8 - shift);
     }
 }
 
-// Desenha números pequenos (5x5 pixels)
 // Desenha números pequenos (5x5 pixels)
 void ssd1306_draw_small_number(ssd1306_t *ssd, char c, uint8_t x, uint8_t y) {
     if (c < '0' || c > '9') return; // Verifica se é um número válido
-    uint16_t index = 568 + (c - '0') * 5; // Início dos números pequenos em font[568]
-    for (uint8_t i = 0; i < 5; ++i) {
-        uint8_t line = font [
-
-index + i];
-        for (uint8_t j = 0; j < 5; ++j) {
-            if ((line >> (4 - j)) & 0x01) {
-                ssd1306_pixel(ssd, x + j, y + i, true);
-            }
-        }
-    }
+    ssd1306_blit(ssd, fonte_pequena_colunas[c - '0'], FONTE_PEQUENA_LARGURA,
+                 FONTE_PEQUENA_MASCARA, x, y, false);
 }
 
 // Desenha um caractere
+// Os glifos já vêm em colunas (tools/gerar_fonte.py); a célula 8x8 é opaca
 void ssd1306_draw_char(ssd1306_t *ssd, char c, uint8_t x, uint8_t y, bool use_small_numbers) {
     if (use_small_numbers && c >= '0' && c <= '9') {
         ssd1306_draw_small_number(ssd, c, x, y);
         return;
     }
-
-    uint16_t index = 0;
-    bool rotate = false;
-
-    // Mapeia caracteres
-    if (c >= '0' && c <= '9') {
-        index = (c - '0' + 1) * 8;
-    } else if (c >= 'A' && c <= 'Z') {
-        index = (c - 'A' + 11) * 8;
-    } else if (c >= 'a' && c <= 'z') {
-        index = (c - 'a' + 37) * 8;
-    } else if (c == ':') {
-        index = 64 * 8;
-        rotate = true;
-    } else if (c == '.') {
-        index = 65 * 8;
-        rotate = true;
-    } else if (c == '>') {
-        index = 66 * 8;
-        rotate = true;
-    } else if (c == '-') {
-        index = 67 * 8;
-        rotate = true;
-    } else if (c == 127) {
-        index = 68 * 8; // Símbolo Ohm
-    } else if (c == '!') {
-        index = 69 * 8;
-        rotate = true;
-    }
-    else if (c == '%') {
-        index = 70 * 8;
-        rotate = true;
-    } 
-    else {
-        return; // Caractere não suportado
-    }
-
-    // Renderiza caractere
-    for (uint8_t i = 0; i < 8; ++i) {
-        uint8_t line = font[index + i];
-        for (uint8_t j = 0; j < 8; ++j) {
-            bool pixel_value = rotate ? (line >> j) & 0x01 : (line >> j) & 0x01;
-            ssd1306_pixel(ssd, x + (rotate ? (7 - j) : i), y + (rotate ? i : j), pixel_value);
-        }
-    }
+    uint8_t indice = ((uint8_t)c < 128) ? fonte_indice[(uint8_t)c] : 0;
+    if (indice == 0) return; // Caractere não suportado
+    ssd1306_blit(ssd, fonte_colunas[indice], FONTE_LARGURA, 0xFF, x, y, true);
 }
 
 // Desenha uma string
@@ -183,48 +420,58 @@ void ssd1306_draw_string(ssd1306_t *ssd, const char *str, uint8_t x, uint8_t y,
 
 // Desenha um retângulo
 void ssd1306_rect(ssd1306_t *ssd, uint8_t top, uint8_t left, uint8_t width, uint8_t height, bool value, bool fill) {
-    for (uint8_t x = left; x < left + width; ++x) {
-        ssd1306_pixel(ssd, x, top, value);
-        ssd1306_pixel(ssd, x, top + height - 1, value);
-    }
-    for (uint8_t y = top; y < top + height; ++y) {
-        ssd1306_pixel(ssd, left, y, value);
-        ssd1306_pixel(ssd, left + width - 1, y, value);
-    }
+    if (width == 0 || height == 0) return;
+    uint8_t right = left + width - 1, bottom = top + height - 1;
     if (fill) {
-        for (uint8_t x = left + 1; x < left + width - 1; ++x) {
-            for (uint8_t y = top + 1; y < top + height - 1; ++y) {
-                ssd1306_pixel(ssd, x, y, value);
-            }
-        }
+        if (left >= ssd->width || top >= ssd->height) return;
+        if (right >= ssd->width || right < left) right = ssd->width - 1;
+        if (bottom >= ssd->height || bottom < top) bottom = ssd->height - 1;
+        ssd1306_fill_area(ssd, left, right, top, bottom, value);
+        return;
     }
+    ssd1306_hline(ssd, left, right, top, value);
+    ssd1306_hline(ssd, left, right, bottom, value);
+    ssd1306_vline(ssd, left, top, bottom, value);
+    ssd1306_vline(ssd, right, top, bottom, value);
 }
 
 // Desenha uma linha (Bresenham)
+// Retas horizontais e verticais viram trechos de bytes; nas demais o ponteiro
+// e a máscara do pixel são atualizados incrementalmente, sem divisões
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0,
                   uint8_t x1, uint8_t y1, bool value) {
+    if (y0 == y1) { ssd1306_hline(ssd, x0, x1, y0, value); return; }
+    if (x0 == x1) { ssd1306_vline(ssd, x0, y0, y1, value); return; }
+
     int dx = abs(x1 - x0), dy = abs(y1 - y0);
     int sx = (x0 < x1) ? 1 : -1, sy = (y0 < y1) ? 1 : -1;
     int err = dx - dy;
+    int x = x0, y = y0;
     while (1) {
-        ssd1306_pixel(ssd, x0, y0, value);
-        if (x0 == x1 && y0 == y1) break;
+        if ((unsigned)x < ssd->width && (unsigned)y < ssd->height) {
+            uint8_t *p = &ssd->ram_buffer[(y >> 3) * ssd->width + x + 1];
+            uint8_t mask = 1u << (y & 7);
+            if (value) *p |= mask; else *p &= ~mask;
+        }
+        if (x == x1 && y == y1) break;
         int e2 = err * 2;
-        if (e2 > -dy) { err -= dy; x0 += sx; }
-        if (e2 < dx) { err += dx; y0 += sy; }
+        if (e2 > -dy) { err -= dy; x += sx; }
+        if (e2 < dx) { err += dx; y += sy; }
     }
 }
 
 // Desenha uma linha horizontal
 void ssd1306_hline(ssd1306_t *ssd, uint8_t x0, uint8_t x1, uint8_t y, bool value) {
-    for (uint8_t x = x0; x <= x1; ++x) {
-        ssd1306_pixel(ssd, x, y, value);
-    }
+    if (x0 > x1) { uint8_t t = x0; x0 = x1; x1 = t; }
+    if (y >= ssd->height || x0 >= ssd->width) return;
+    if (x1 >= ssd->width) x1 = ssd->width - 1;
+    ssd1306_span(&ssd->ram_buffer[(y >> 3) * ssd->width + x0 + 1], x1 - x0 + 1, 1u << (y & 7), value);
 }
 
 // Desenha uma linha vertical
 void ssd1306_vline(ssd1306_t *ssd, uint8_t x, uint8_t y0, uint8_t y1, bool value) {
-    for (uint8_t y = y0; y <= y1; ++y) {
-        ssd1306_pixel(ssd, x, y, value);
-    }
-}
\ No newline at end of file
+    if (y0 > y1) { uint8_t t = y0; y0 = y1; y1 = t; }
+    if (x >= ssd->width || y0 >= ssd->height) return;
+    if (y1 >= ssd->height) y1 = ssd->height - 1;
+    ssd1306_fill_area(ssd, x, x, y0, y1, value);
+}
@@ -6,19 +6,45 @@
 #include <stdbool.h>
 #include "hardware/i2c.h"
 
+// Maior display atendido no MODO_ESTATICO, em que os buffers são reservados no link
+#define SSD1306_WIDTH_MAX 128
+#define SSD1306_HEIGHT_MAX 64
+
+// Callback chamado (em contexto de interrupção) ao fim de um flush assíncrono
+typedef void (*ssd1306_flush_cb_t)(void *ctx);
+
 typedef struct {
     uint8_t width, height, pages, address;
     i2c_inst_t *i2c_port;
     uint16_t bufsize;
     uint8_t *ram_buffer;
+    uint8_t *shadow_buffer;     // Cópia do que já está na GDDRAM do display
+    bool full_refresh;          // Força envio completo no próximo flush
     uint8_t port_buffer[2];
+    uint32_t bytes_last_flush;  // Bytes enviados no último flush (comandos + dados)
+    uint32_t bytes_total;       // Bytes acumulados desde a inicialização
+    uint32_t flush_count;       // Quantidade de flushes realizados
+    uint16_t *tx_stream;        // Segundo buffer: quadro em trânsito, já no formato IC_DATA_CMD
+    int dma_chan;               // Canal DMA que alimenta o FIFO de TX do I2C
+    volatile bool flush_busy;   // Há um flush assíncrono em andamento
+    ssd1306_flush_cb_t flush_cb;
+    void *flush_ctx;
 } ssd1306_t;
 
 void ssd1306_init(ssd1306_t *ssd, uint8_t width, uint8_t height,
                   bool external_vcc, uint8_t address, i2c_inst_t *i2c);
 void ssd1306_config(ssd1306_t *ssd);
 void ssd1306_command(ssd1306_t *ssd, uint8_t command);
+void ssd1306_set_power(ssd1306_t *ssd, bool on);
+void ssd1306_set_contrast(ssd1306_t *ssd, uint8_t contrast);
 void ssd1306_send_data(ssd1306_t *ssd);
+void ssd1306_invalidate(ssd1306_t *ssd);
+bool ssd1306_send_data_async(ssd1306_t *ssd);
+bool ssd1306_flush_busy(ssd1306_t *ssd);
+void ssd1306_wait_flush(ssd1306_t *ssd);
+void ssd1306_set_flush_callback(ssd1306_t *ssd, ssd1306_flush_cb_t cb, void *ctx);
+void ssd1306_save_layer(ssd1306_t *ssd, uint8_t *layer);
+void ssd1306_load_layer(ssd1306_t *ssd, const uint8_t *layer);
 void ssd1306_pixel(ssd1306_t *ssd, uint8_t x, uint8_t y, bool value);
 void ssd1306_fill(ssd1306_t *ssd, bool value);
 void ssd1306_line(ssd1306_t *ssd, uint8_t x0, uint8_t y0,
@@ -0,0 +1,100 @@
+#include "telas.h"
+#include <string.h>
+#include "sensor.h"
+#include "formato.h"
+
+// Geometria das telas de gráfico
+#define GRAFICO_X 15
+#define GRAFICO_Y 54
+#define GRAFICO_ALTURA 45
+#define GRAFICO_LARGURA 100
+
+// Título, eixos, marcas e rótulos de uma tela de gráfico
+static void desenhar_fundo_grafico(ssd1306_t *ssd, const char *titulo) {
+    uint8_t titulo_width = strlen(titulo) * 5;
+    uint8_t titulo_x_pos = (ssd->width - titulo_width) / 2;
+    ssd1306_draw_string(ssd, titulo, titulo_x_pos, 5, true);
+    ssd1306_line(ssd, GRAFICO_X, GRAFICO_Y, GRAFICO_X + GRAFICO_LARGURA, GRAFICO_Y, true);
+    ssd1306_line(ssd, GRAFICO_X, GRAFICO_Y, GRAFICO_X, GRAFICO_Y - GRAFICO_ALTURA, true);
+    for (int i = 0; i <= 5; i++) {
+        uint8_t y_mark = GRAFICO_Y - (i * GRAFICO_ALTURA / 5);
+        ssd1306_line(ssd, GRAFICO_X - 3, y_mark, GRAFICO_X, y_mark, true);
+        if (i % 2 == 0) formato_desenhar_fixo(ssd, i * 20, 0, NULL, 0, y_mark - 3, true);
+    }
+    for (int i = 0; i <= 4; i++) {
+        uint8_t x_mark = GRAFICO_X + (i * GRAFICO_LARGURA / 4);
+        ssd1306_line(ssd, x_mark, GRAFICO_Y, x_mark, GRAFICO_Y + 2, true);
+        formato_desenhar_fixo(ssd, i * 5, 0, NULL, x_mark - 8, GRAFICO_Y + 2, true);
+    }
+}
+
+// Série histórica de um gráfico (percentuais 0-100)
+static void desenhar_serie_grafico(ssd1306_t *ssd, const telas_grafico_t *grafico, const uint16_t *serie) {
+    int n = (grafico->contagem < TELAS_GRAFICO_PONTOS) ? grafico->contagem : TELAS_GRAFICO_PONTOS;
+    for (int i = 0; i < n - 1; i++) {
+        int idx_atual = (grafico->indice - n + i + TELAS_GRAFICO_PONTOS) % TELAS_GRAFICO_PONTOS;
+        int idx_proximo = (grafico->indice - n + i + 1 + TELAS_GRAFICO_PONTOS) % TELAS_GRAFICO_PONTOS;
+        uint8_t y_atual = GRAFICO_Y - (uint8_t)(serie[idx_atual] * GRAFICO_ALTURA / PCT_X100(100));
+        uint8_t y_proximo = GRAFICO_Y - (uint8_t)(serie[idx_proximo] * GRAFICO_ALTURA / PCT_X100(100));
+        uint8_t x_atual = GRAFICO_X + (i * GRAFICO_LARGURA / (TELAS_GRAFICO_PONTOS - 1));
+        uint8_t x_proximo = GRAFICO_X + ((i + 1) * GRAFICO_LARGURA / (TELAS_GRAFICO_PONTOS - 1));
+        ssd1306_line(ssd, x_atual, y_atual, x_proximo, y_proximo, true);
+    }
+}
+
+void telas_montar_fundo(ssd1306_t *ssd, uint8_t tela) {
+    ssd1306_fill(ssd, false);
+    if (tela == 0) {
+        // Tela 1: rótulos das informações básicas
+        ssd1306_draw_string(ssd, "QntChuva:", 0, 0, false);
+        ssd1306_draw_string(ssd, "Chuva:", 0, 13, false);
+        ssd1306_draw_string(ssd, "Nivel:", 0, 26, false);
+        ssd1306_draw_string(ssd, "Status:", 0, 39, false);
+        ssd1306_draw_string(ssd, "Cor:", 0, 52, false);
+    } else if (tela == 1) {
+        // Tela 2: rótulos e contornos das barras
+        uint8_t bar_width = ssd->width - 20, bar_height = 8;
+        ssd1306_draw_string(ssd, "Barra Chuva:", 0, 0, false);
+        ssd1306_rect(ssd, 10, 0, bar_width, bar_height, true, false);
+        ssd1306_draw_string(ssd, "Barra Nivel:", 0, 25, false);
+        ssd1306_rect(ssd, 35, 0, bar_width, bar_height, true, false);
+        ssd1306_draw_string(ssd, "Previsao:", 0, 50, false);
+    } else if (tela == 2) {
+        desenhar_fundo_grafico(ssd, "Chuva %");   // Tela 3
+    } else {
+        desenhar_fundo_grafico(ssd, "Nivel %");   // Tela 4
+    }
+}
+
+// As colunas de início (n * 8) seguem o comprimento dos rótulos do fundo
+void telas_desenhar_valores(ssd1306_t *ssd, uint8_t tela, const telas_valores_t *v) {
+    if (tela == 0) {
+        formato_desenhar_fixo(ssd, v->chuva_mmh, 2, "mm", 9 * 8, 0, false);
+        uint16_t chuva_x10 = (v->chuva_pct + 5) / 10; // Décimos de %, arredondado
+        formato_desenhar_fixo(ssd, chuva_x10, 1, "%", 7 * 8, 13, false);
+        uint16_t nivel_x10 = (v->nivel_pct + 5) / 10;
+        formato_desenhar_fixo(ssd, nivel_x10, 1, "%", 7 * 8, 26, false);
+        ssd1306_draw_string(ssd, v->alerta ? "ALERTA!" : "Normal", 8 * 8, 39, false);
+        const char* cor_display;
+        if (v->nivel_pct > PCT_X100(95)) cor_display = "V. Pisc.";
+        else if (v->nivel_pct < PCT_X100(70) && v->chuva_pct > PCT_X100(80)) cor_display = "Amarelo";
+        else if (v->nivel_pct >= PCT_X100(70) && v->nivel_pct < PCT_X100(95) && v->chuva_pct > PCT_X100(80)) cor_display = "Vermelho";
+        else if (v->nivel_pct < PCT_X100(70) && v->chuva_pct <= PCT_X100(80)) cor_display = "Verde";
+        else cor_display = "Apagado";
+        ssd1306_draw_string(ssd, cor_display, 5 * 8, 52, false);
+    } else if (tela == 1) {
+        uint8_t bar_width = ssd->width - 20, bar_height = 8;
+        uint8_t chuva_fill = (uint8_t)((uint32_t)v->chuva_pct * (bar_width - 2) / PCT_X100(100));
+        if (chuva_fill > 0) ssd1306_rect(ssd, 10 + 1, 1, chuva_fill, bar_height - 2, true, true);
+        uint8_t nivel_fill = (uint8_t)((uint32_t)v->nivel_pct * (bar_width - 2) / PCT_X100(100));
+        if (nivel_fill > 0) ssd1306_rect(ssd, 35 + 1, 1, nivel_fill, bar_height - 2, true, true);
+        if (v->previsao_valida) {
+            uint16_t previsto_x10 = (v->nivel_previsto + 5) / 10;
+            formato_desenhar_fixo(ssd, previsto_x10, 1, "%", 9 * 8, 50, false);
+        } else {
+            ssd1306_draw_string(ssd, " N/A", 9 * 8, 50, false);
+        }
+    } else {
+        desenhar_serie_grafico(ssd, v->grafico, tela == 2 ? v->grafico->chuva : v->grafico->nivel);
+    }
+}
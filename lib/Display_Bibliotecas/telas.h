@@ -0,0 +1,39 @@
+// telas.h
+// As quatro telas de tarefa_exibicao, separadas da tarefa para que os
+// benchmarks (bench/) renderizem exatamente os mesmos quadros
+#ifndef TELAS_H
+#define TELAS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "ssd1306.h"
+
+#define TELAS_QUANTIDADE 4
+#define TELAS_GRAFICO_PONTOS 10     // Leituras mostradas nos gráficos
+
+// Histórico dos gráficos: anel com as últimas leituras (centésimos de %)
+typedef struct {
+    uint16_t chuva[TELAS_GRAFICO_PONTOS];
+    uint16_t nivel[TELAS_GRAFICO_PONTOS];
+    uint8_t indice;                 // Próxima posição a escrever
+    uint8_t contagem;               // Posições preenchidas
+} telas_grafico_t;
+
+// Valores ao vivo de um quadro (percentuais e mm/h em centésimos, ver sensor.h)
+typedef struct {
+    uint16_t chuva_mmh;
+    uint16_t chuva_pct;
+    uint16_t nivel_pct;
+    bool alerta;
+    bool previsao_valida;           // Tela 2: false mostra "N/A"
+    uint16_t nivel_previsto;
+    const telas_grafico_t *grafico; // Telas 3 e 4
+} telas_valores_t;
+
+// Desenha a parte fixa da tela (rótulos, contornos, eixos) sobre o buffer limpo
+void telas_montar_fundo(ssd1306_t *ssd, uint8_t tela);
+
+// Desenha os valores da tela sobre o fundo já presente no buffer
+void telas_desenhar_valores(ssd1306_t *ssd, uint8_t tela, const telas_valores_t *valores);
+
+#endif /* TELAS_H */
@@ -27,6 +27,10 @@
 
  #ifndef FREERTOS_CONFIG_H
  #define FREERTOS_CONFIG_H
+
+ /* Nomes e ganchos do FreeRTOS-Kernel V11.1 ou mais novo, no alvo e na
+  * simulação (configNUMBER_OF_CORES, vApplicationGetPassiveIdleTaskMemory
+  * com índice, configSTACK_DEPTH_TYPE nos ganchos de memória estática) */
  
  /*-----------------------------------------------------------
   * Application specific definitions.
@@ -40,15 +44,44 @@
   * See http://www.freertos.org/a00110.html
   *----------------------------------------------------------*/
  
+ /* Modo de baixo consumo (opção MODO_BAIXO_CONSUMO do CMake): tickless idle
+  * dorme em WFI entre os prazos das tarefas em vez de acordar a cada tick */
+ #ifndef MODO_BAIXO_CONSUMO
+ #define MODO_BAIXO_CONSUMO                      0
+ #endif
+
+ /* Modo SMP (opção MODO_SMP do CMake): os dois núcleos do RP2040, com afinidade
+  * definida por tarefa em main.c. O port RP2040 não suporta tickless em SMP */
+ #ifndef MODO_SMP
+ #define MODO_SMP                                0
+ #endif
+ #if MODO_SMP && MODO_BAIXO_CONSUMO
+ #error "MODO_BAIXO_CONSUMO (tickless idle) não é suportado junto com MODO_SMP"
+ #endif
+
+ /* Modo estático (opção MODO_ESTATICO do CMake): pilhas, TCBs, filas, timer e
+  * buffers do display reservados no link; sem heap do FreeRTOS, nenhuma
+  * alocação pode falhar depois do boot */
+ #ifndef MODO_ESTATICO
+ #define MODO_ESTATICO                           0
+ #endif
+
+ /* Perfil de pilhas (opção MODO_PERFIL_PILHAS do CMake): pilhas folgadas e
+  * roteiro de sensores que mede a folga mínima de cada tarefa (perfil_pilhas.h) */
+ #ifndef MODO_PERFIL_PILHAS
+ #define MODO_PERFIL_PILHAS                      0
+ #endif
+
  /* Scheduler Related */
  #define configUSE_PREEMPTION                    1
- #define configUSE_TICKLESS_IDLE                 0
+ #define configUSE_TICKLESS_IDLE                 MODO_BAIXO_CONSUMO
+ #define configEXPECTED_IDLE_TIME_BEFORE_SLEEP   2
  #define configUSE_IDLE_HOOK                     0
  #define configUSE_TICK_HOOK                     0
  #define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
  #define configMAX_PRIORITIES                    32
  #define configMINIMAL_STACK_SIZE                ( configSTACK_DEPTH_TYPE ) 256
- #define configUSE_16_BIT_TICKS                  0
+ #define configTICK_TYPE_WIDTH_IN_BITS           TICK_TYPE_WIDTH_32_BITS
  
  #define configIDLE_SHOULD_YIELD                 1
  
@@ -69,9 +102,17 @@
  #define configMESSAGE_BUFFER_LENGTH_TYPE        size_t
  
  /* Memory allocation related definitions. */
- #define configSUPPORT_STATIC_ALLOCATION         0
- #define configSUPPORT_DYNAMIC_ALLOCATION        1
- #define configTOTAL_HEAP_SIZE                   (128*1024)
+ #define configSUPPORT_STATIC_ALLOCATION         MODO_ESTATICO
+ #define configSUPPORT_DYNAMIC_ALLOCATION        ( !MODO_ESTATICO )
+ /* Heap do modo dinâmico: o que o boot aloca (HEAP_NECESSARIO em main.c, cerca
+  * de 19 KB no SMP com as pilhas escolhidas à mão, 48 KB com as do perfil) com
+  * pelo menos 25 % de folga, verificado no build por _Static_assert. Depois do
+  * boot nada mais é alocado; o mínimo livre aparece no relatório de saúde ('s') */
+ #if MODO_PERFIL_PILHAS
+ #define configTOTAL_HEAP_SIZE                   (64*1024)
+ #else
+ #define configTOTAL_HEAP_SIZE                   (26*1024)
+ #endif
  #define configAPPLICATION_ALLOCATED_HEAP        0
  
  /* Hook function related definitions. */
@@ -80,7 +121,12 @@
  #define configUSE_DAEMON_TASK_STARTUP_HOOK      0
  
  /* Run time and task stats gathering related definitions. */
- #define configGENERATE_RUN_TIME_STATS           0
+ /* Run-time contado no timer de 1 MHz do RP2040, que já roda desde o boot.
+  * 64 bits para a CPU % não dar a volta em ~71 min. */
+ #define configGENERATE_RUN_TIME_STATS           1
+ #define configRUN_TIME_COUNTER_TYPE             uint64_t
+ #define portCONFIGURE_TIMER_FOR_RUN_TIME_STATS()
+ #define portGET_RUN_TIME_COUNTER_VALUE()        saude_contador_us()
  #define configUSE_TRACE_FACILITY                1
  #define configUSE_STATS_FORMATTING_FUNCTIONS    0
  
@@ -102,9 +148,15 @@
  */
  
  /* SMP port only */
- #define configNUM_CORES                         1
- #define configTICK_CORE                         1
+ #if MODO_SMP
+ #define configNUMBER_OF_CORES                   2
+ #define configUSE_CORE_AFFINITY                 1
+ #define configUSE_PASSIVE_IDLE_HOOK             0
  #define configRUN_MULTIPLE_PRIORITIES           1
+ #else
+ #define configNUMBER_OF_CORES                   1
+ #endif
+ #define configTICK_CORE                         1
  
  /* RP2040 specific */
  #define configSUPPORT_PICO_SYNC_INTEROP         1
@@ -134,5 +186,23 @@
  #define INCLUDE_xQueueGetMutexHolder            1
  
  /* A header file that defines trace macro can be included here. */
- 
+ #include "atividade.h"
+ #include "saude.h"
+ #include "rastro.h"
+ #define traceTASK_SWITCHED_IN()                 do { atividade_entrou(); rastro_tarefa_entrou(); } while (0)
+ #define traceTASK_SWITCHED_OUT()                atividade_saiu()
+ #define configPRE_SLEEP_PROCESSING(x)           atividade_antes_dormir()
+ #define configPOST_SLEEP_PROCESSING(x)          atividade_depois_dormir()
+ /* Expandidos dentro do queue.c, onde os campos da fila são visíveis */
+ #define traceQUEUE_SEND(pxQueue)                do { saude_fila_enviada((pxQueue)->uxQueueNumber, (pxQueue)->uxMessagesWaiting, (pxQueue)->uxLength); \
+                                                      rastro_fila(RASTRO_FILA_ENVIO, (pxQueue)->uxQueueNumber); } while (0)
+ #define traceQUEUE_SEND_FROM_ISR(pxQueue)       traceQUEUE_SEND(pxQueue)
+ #define traceQUEUE_RECEIVE(pxQueue)             rastro_fila(RASTRO_FILA_RECEBIDO, (pxQueue)->uxQueueNumber)
+ #define traceQUEUE_RECEIVE_FROM_ISR(pxQueue)    rastro_fila(RASTRO_FILA_RECEBIDO, (pxQueue)->uxQueueNumber)
+ #define traceBLOCKING_ON_QUEUE_SEND(pxQueue)    rastro_fila(RASTRO_FILA_BLOQUEIO_ENVIO, (pxQueue)->uxQueueNumber)
+ #define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue) rastro_fila(RASTRO_FILA_BLOQUEIO_RECEBE, (pxQueue)->uxQueueNumber)
+ #define traceTASK_NOTIFY_WAIT_BLOCK(x)          rastro_evento(RASTRO_NOTIFICACAO_BLOQUEIO, 0)
+ #define traceTASK_NOTIFY_TAKE_BLOCK(x)          rastro_evento(RASTRO_NOTIFICACAO_BLOQUEIO, 0)
+ #define traceTASK_DELAY()                       rastro_evento(RASTRO_ATRASO, 0)
+
  #endif /* FREERTOS_CONFIG_H */
\ No newline at end of file
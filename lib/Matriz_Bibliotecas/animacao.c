@@ -0,0 +1,106 @@
+#include "animacao.h"
+#include "hardware/sync.h"
+
+#define ANIMACAO_TROCA_US 1000          // Atraso do primeiro quadro de uma sequência nova
+#define ANIMACAO_LINHA_OCUPADA_US 1000  // Nova tentativa se o quadro anterior ainda ocupa a linha
+
+/* ---------- Quadros ---------- */
+static const uint8_t PAD_VAZIO[5] = {0};
+
+// Chuva: as gotas nascem juntas na linha de cima, descem uma linha a cada
+// passo e somem no fundo (mesmo desenho da antiga matriz_draw_rain_animation)
+static const uint8_t PAD_CHUVA[4][5] = {
+    {0b11111, 0, 0, 0, 0},
+    {0, 0b11111, 0, 0, 0},
+    {0, 0, 0b11111, 0, 0},
+    {0, 0, 0, 0b11111, 0},
+};
+
+#define CHUVA_CICLO                                                          \
+    {PAD_CHUVA[0], COR_AZUL, 50}, {PAD_CHUVA[1], COR_AZUL, 50},              \
+    {PAD_CHUVA[2], COR_AZUL, 50}, {PAD_CHUVA[3], COR_AZUL, 50},              \
+    {PAD_VAZIO, COR_OFF, 50}
+#define CHUVA_4_CICLOS CHUVA_CICLO, CHUVA_CICLO, CHUVA_CICLO, CHUVA_CICLO
+
+static const animacao_quadro_t quadros_apagada[] = {
+    {PAD_VAZIO, COR_OFF, 0},
+};
+
+static const animacao_quadro_t quadros_alerta[] = {
+    {PAD_X, COR_VERMELHO, 0},
+};
+
+static const animacao_quadro_t quadros_alerta_chuva[] = {
+    CHUVA_4_CICLOS, CHUVA_4_CICLOS, CHUVA_4_CICLOS, CHUVA_4_CICLOS,  // 16 x 250 ms = 4 s
+    {PAD_EXC, COR_AMARELO, 4000},
+    {PAD_X, COR_VERMELHO, 4000},
+};
+
+const animacao_t ANIM_APAGADA = {quadros_apagada, count_of(quadros_apagada), false};
+const animacao_t ANIM_ALERTA = {quadros_alerta, count_of(quadros_alerta), false};
+const animacao_t ANIM_ALERTA_CHUVA = {quadros_alerta_chuva, count_of(quadros_alerta_chuva), true};
+
+/* ---------- Reprodução ---------- */
+// Estado compartilhado entre animacao_tocar (tarefa) e avancar (IRQ do alarme,
+// possivelmente no outro núcleo)
+static spin_lock_t *trava;
+static const animacao_t *atual = NULL;
+static uint16_t indice = 0;
+static alarm_id_t alarme = 0;           // Alarme da sequência atual (0 = parada em um quadro)
+static uint32_t mudanca_pendente_us = 0;  // Mudança cujo primeiro quadro ainda não saiu (0 = nenhuma)
+static animacao_enviado_t enviado = NULL;
+
+// Desenha e envia o quadro atual; o retorno agenda o próximo (ver alarm_callback_t)
+static int64_t avancar(alarm_id_t id, void *dados) {
+    (void)dados;
+    int64_t proximo = 0;
+    uint32_t salvo = spin_lock_blocking(trava);
+    if (id != alarme) {
+        // Alarme de uma sequência que já foi trocada
+        spin_unlock(trava, salvo);
+        return 0;
+    }
+
+    const animacao_quadro_t *q = &atual->quadros[indice];
+    matriz_draw_pattern(q->padrao, q->cor);
+    if (!matriz_flush()) {
+        spin_unlock(trava, salvo);
+        return ANIMACAO_LINHA_OCUPADA_US;               // A partir de agora
+    }
+
+    uint32_t mudanca_us = mudanca_pendente_us;                   // Só o primeiro quadro enviado conta
+    mudanca_pendente_us = 0;
+    if (q->duracao_ms == 0 || (indice + 1 == atual->n && !atual->repetir)) {
+        alarme = 0;                                     // Quadro fixo: sem alarme até a próxima troca
+    } else {
+        indice = (indice + 1) % atual->n;
+        proximo = -(int64_t)q->duracao_ms * 1000;       // A partir do instante previsto deste quadro
+    }
+    spin_unlock(trava, salvo);
+
+    if (mudanca_us != 0 && enviado != NULL) enviado(mudanca_us);
+    return proximo;
+}
+
+void animacao_iniciar(animacao_enviado_t callback) {
+    enviado = callback;
+    trava = spin_lock_instance(spin_lock_claim_unused(true));
+}
+
+void animacao_tocar(const animacao_t *sequencia, uint32_t mudanca_us) {
+    uint32_t salvo = spin_lock_blocking(trava);
+    if (sequencia == atual && alarme >= 0) {
+        spin_unlock(trava, salvo);
+        return;
+    }
+    alarm_id_t anterior = alarme;
+    atual = sequencia;
+    indice = 0;
+    mudanca_pendente_us = mudanca_us;
+    // Nunca no passado: com fire_if_past, a callback rodaria aqui dentro, com a trava tomada
+    alarme = add_alarm_in_us(ANIMACAO_TROCA_US, avancar, NULL, false);
+    spin_unlock(trava, salvo);
+
+    // Se o alarme antigo já estiver na callback, ela vê o id trocado e não se reagenda
+    if (anterior > 0) cancel_alarm(anterior);
+}
@@ -0,0 +1,44 @@
+#ifndef ANIMACAO_H
+#define ANIMACAO_H
+
+#include "matriz_led.h"
+
+/* ---------- Animações da matriz ----------
+ * Uma sequência é uma tabela constante (em flash) de quadros com duração
+ * própria. Um alarme de hardware desenha cada quadro no quadro da matriz e
+ * o envia por DMA (matriz_flush); a tarefa só escolhe a sequência.
+ * O próximo alarme é agendado a partir do instante previsto do anterior, não
+ * de quando a callback rodou, então a animação não acumula atraso.
+ * A latência da troca é medida no primeiro quadro da sequência nova que sai
+ * para o PIO: o alarme devolve o instante da mudança por animacao_enviado_t.
+ */
+typedef struct {
+    const uint8_t *padrao;    // 5 linhas, bit 4 = coluna 0 (mesmo formato de PAD_X)
+    uint32_t cor;             // GRB
+    uint16_t duracao_ms;      // 0: fica neste quadro até outra sequência
+} animacao_quadro_t;
+
+typedef struct {
+    const animacao_quadro_t *quadros;
+    uint16_t n;
+    bool repetir;             // Volta ao primeiro quadro depois do último
+} animacao_t;
+
+/* ---------- Sequências de tarefa_matriz_led ---------- */
+extern const animacao_t ANIM_APAGADA;       // Sem alerta
+extern const animacao_t ANIM_ALERTA;        // Alerta sem chuva intensa: "X" vermelho
+extern const animacao_t ANIM_ALERTA_CHUVA;  // Chuva (4 s), "!" amarelo (4 s), "X" vermelho (4 s)
+
+// Chamada no alarme (IRQ) quando o primeiro quadro de uma sequência nova é
+// enviado; recebe o mudanca_us passado a animacao_tocar
+typedef void (*animacao_enviado_t)(uint32_t mudanca_us);
+
+// Reserva o spin lock do estado; chamar depois de inicializar_matriz_led
+// enviado pode ser NULL
+void animacao_iniciar(animacao_enviado_t enviado);
+
+// Troca a sequência em ~1 ms; se ela já estiver tocando, segue de onde está e
+// mudanca_us é ignorado (nenhum quadro muda). mudanca_us = 0: sem medição
+void animacao_tocar(const animacao_t *sequencia, uint32_t mudanca_us);
+
+#endif /* ANIMACAO_H */
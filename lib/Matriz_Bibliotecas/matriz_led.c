@@ -1,5 +1,7 @@
 #include "matriz_led.h"
 #include <stdlib.h>
+#include <string.h>
+#include "hardware/dma.h"
 
 const CorRGB PALETA_CORES[] = {
     {"Branco",  255, 255, 255},
@@ -104,8 +106,17 @@ const bool padrao_numeros[10][25] = {
     }
 };
 
-static inline void ws2812_put(uint32_t grb) {  // Envia dados GRB para um LED
-    pio_sm_put_blocking(pio0, 0, grb << 8u);  // Desloca 8 bits para alinhar protocolo WS2812
+// Quadro em RAM, já no formato do FIFO do PIO (GRB nos 24 bits altos), na ordem física dos LEDs
+static uint32_t quadro[NUM_PIXELS];
+static uint32_t enviado[NUM_PIXELS];    // Último quadro entregue ao DMA (origem da transferência)
+static bool enviado_valido = false;     // Conteúdo dos LEDs é desconhecido antes do primeiro envio
+static int dma_chan;                    // Canal DMA que alimenta o FIFO de TX da state machine 0
+static uint64_t livre_em_us = 0;        // Fim do último quadro na linha, incluindo o reset
+static uint32_t bytes_total = 0;
+
+// Placa montada "de cabeça-para-baixo": a linha de cima (y = 0) é a última da cadeia
+static inline void pixel_fisico(int indice, uint32_t cor) {
+    quadro[indice] = cor << 8u;  // Desloca 8 bits para alinhar protocolo WS2812
 }
 
 void inicializar_matriz_led(void) {  // Configura PIO para controlar WS2812
@@ -113,76 +124,70 @@ void inicializar_matriz_led(void) {  // Configura PIO para controlar WS2812
     uint off = pio_add_program(pio, &ws2812_program);  // Carrega programa PIO
     ws2812_program_init(pio, 0, off, PINO_WS2812, 800000, RGBW_ATIVO);  // Inicia PIO a 800kHz
     srand(to_us_since_boot(get_absolute_time()));  // Inicializa semente para rand()
+
+    // Canal DMA pacificado pelo DREQ de TX da state machine: um quadro por transferência
+    dma_chan = dma_claim_unused_channel(true);
+    dma_channel_config c = dma_channel_get_default_config(dma_chan);
+    channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+    channel_config_set_read_increment(&c, true);
+    channel_config_set_write_increment(&c, false);
+    channel_config_set_dreq(&c, pio_get_dreq(pio, 0, true));
+    dma_channel_configure(dma_chan, &c, &pio->txf[0], enviado, NUM_PIXELS, false);
+
+    matriz_fill(COR_OFF);
+}
+
+void matriz_set_pixel(uint8_t x, uint8_t y, uint32_t cor) {
+    if (x >= NUM_COLUNAS || y >= NUM_LINHAS) return;
+    pixel_fisico((NUM_LINHAS - 1 - y) * NUM_COLUNAS + x, cor);
+}
+
+void matriz_fill(uint32_t cor) {
+    for (int i = 0; i < NUM_PIXELS; ++i) pixel_fisico(i, cor);
+}
+
+// Envia o quadro por DMA se ele mudou desde o último envio
+// A linha só aceita outro quadro depois que o anterior saiu inteiro e ficou
+// WS2812_RESET_US em nível baixo; até lá retorna false sem esperar, e o quadro
+// continua pendente para a próxima chamada
+bool matriz_flush(void) {
+    if (enviado_valido && memcmp(quadro, enviado, sizeof(quadro)) == 0) return true;
+
+    uint64_t agora = time_us_64();
+    if (agora < livre_em_us) return false;
+
+    memcpy(enviado, quadro, sizeof(quadro));
+    enviado_valido = true;
+    dma_channel_transfer_from_buffer_now(dma_chan, enviado, NUM_PIXELS);
+    livre_em_us = agora + NUM_PIXELS * WS2812_US_POR_PIXEL + WS2812_RESET_US;
+    bytes_total += NUM_PIXELS * 3;
+    return true;
+}
+
+uint32_t matriz_bytes_total(void) {
+    return bytes_total;
 }
 
 void matriz_draw_pattern(const uint8_t pad[5], uint32_t cor_on) {  // Desenha padrão na matriz
-    /* placa montada "de cabeça-para-baixo" → linha 4 primeiro */
-    for (int lin = 4; lin >= 0; --lin) {
-        for (int col = 0; col < 5; ++col) {
+    for (int lin = 0; lin < NUM_LINHAS; ++lin) {
+        for (int col = 0; col < NUM_COLUNAS; ++col) {
             bool aceso = pad[lin] & (1 << (4 - col));  // Verifica bit do padrão
-            ws2812_put(aceso ? cor_on : COR_OFF);  // Aplica cor ou desliga LED
+            matriz_set_pixel(col, lin, aceso ? cor_on : COR_OFF);  // Aplica cor ou desliga LED
         }
     }
-    sleep_us(60);  // Latência para atualizar matriz
 }
 
 void matriz_draw_number(uint8_t numero, uint32_t cor_on) {  // Desenha um número na matriz
     if (numero > 9) {
         matriz_draw_pattern(PAD_X, COR_VERMELHO);  // Desenha "X" vermelho se o número for maior que 9
     } else {
-        /* O formato da matriz boolean requer uma lógica diferente para desenhar */
-        for (int lin = 0; lin < 5; ++lin) {
-            for (int col = 0; col < 5; ++col) {
-                bool aceso = padrao_numeros[numero][lin * 5 + col];
-                ws2812_put(aceso ? cor_on : COR_OFF);
-            }
-        }
-        sleep_us(60);  // Latência para atualizar matriz
-    }
-}
-
-void matriz_draw_rain_animation(uint32_t cor_on) {
-    static uint8_t gotas[5] = {0};  // Posição Y de cada gota por coluna (0 a 4, 0=desligada)
-    static uint32_t ultimo_tempo = 0;
-    uint32_t tempo_atual = to_ms_since_boot(get_absolute_time());
-
-    // Atualiza a cada 50ms para movimento mais rápido
-    if (tempo_atual - ultimo_tempo >= 50) {
-        // Limpa a matriz
-        matriz_clear();
-
-        // Atualiza posição das gotas
-        for (int col = 0; col < 5; col++) {
-            if (gotas[col] > 0) {
-                gotas[col]++;  // Move gota para baixo
-                if (gotas[col] > 4) gotas[col] = 0;  // Reseta se atingir o fundo
-            } else {
-                // Sempre criar uma nova gota quando a coluna estiver vazia
-                gotas[col] = 1;  // Começa na linha superior
-            }
+        /* Os padrões de número já estão na ordem física dos LEDs */
+        for (int i = 0; i < NUM_PIXELS; ++i) {
+            pixel_fisico(i, padrao_numeros[numero][i] ? cor_on : COR_OFF);
         }
-
-        // Desenha gotas
-        for (int col = 0; col < 5; col++) {
-            if (gotas[col] > 0) {
-                // Calcula índice do LED (matriz invertida: linha 4 - (gotas[col] - 1))
-                int lin = 4 - (gotas[col] - 1);
-                for (int i = 0; i < NUM_PIXELS; i++) {
-                    if (i == lin * 5 + col) {
-                        ws2812_put(cor_on);  // Acende o LED da gota
-                    } else {
-                        ws2812_put(COR_OFF);  // Desliga os outros LEDs
-                    }
-                }
-            }
-        }
-        sleep_us(60);  // Latência para atualizar matriz
-        ultimo_tempo = tempo_atual;
     }
 }
 
 void matriz_clear(void) {  // Limpa todos os LEDs
-    for (int i = 0; i < NUM_PIXELS; ++i)
-        ws2812_put(COR_OFF);  // Desliga cada LED
-    sleep_us(60);  // Latência para confirmar limpeza
-}
\ No newline at end of file
+    matriz_fill(COR_OFF);
+}
@@ -10,6 +10,8 @@
 #define NUM_COLUNAS   5  // Número de colunas da matriz
 #define NUM_PIXELS    (NUM_LINHAS * NUM_COLUNAS)  // Total de LEDs (25)
 #define RGBW_ATIVO    false  // Define protocolo RGB (não RGBW)
+#define WS2812_US_POR_PIXEL 30  // 24 bits a 800 kHz
+#define WS2812_RESET_US 60      // Linha em nível baixo que fecha o quadro (mínimo 50 us)
 
 /* ---------- Utilidades de cor ---------- */
 #define GRB(r,g,b)   ( ((uint32_t)(g) << 16) | ((uint32_t)(r) << 8) | (b) )  // Converte RGB para formato GRB do WS2812
@@ -47,11 +49,17 @@ extern const uint8_t PAD_X[5];    // Padrão "X" para vermelho
 /* ---------- Padrões para dígitos 0-9 (novo formato) ---------- */
 extern const bool padrao_numeros[10][25];  // Array 2D com padrões dos números 0-9
 
-/* ---------- API ---------- */
-void inicializar_matriz_led(void);  // Inicializa PIO para WS2812
+/* ---------- API ----------
+ * As funções de desenho só escrevem no quadro em RAM (25 pixels GRB);
+ * matriz_flush entrega o quadro inteiro ao PIO em uma transferência DMA.
+ */
+void inicializar_matriz_led(void);  // Inicializa PIO e DMA para WS2812
+void matriz_set_pixel(uint8_t x, uint8_t y, uint32_t cor);  // x, y = 0-4, y = 0 é a linha de cima
+void matriz_fill(uint32_t cor);  // Pinta o quadro inteiro
+bool matriz_flush(void);  // Envia o quadro se mudou; false se a linha ainda está ocupada (quadro fica pendente)
+uint32_t matriz_bytes_total(void);  // Bytes enviados aos LEDs desde a inicialização
 void matriz_draw_pattern(const uint8_t pad[5], uint32_t cor_on);  // Desenha padrão na matriz
 void matriz_draw_number(uint8_t numero, uint32_t cor_on);  // Desenha número (0-9) na matriz
-void matriz_draw_rain_animation(uint32_t cor_on);  // Desenha animação de chuva
 void matriz_clear(void);  // Limpa todos os LEDs
 
 #endif /* MATRIZ_LED_H */
\ No newline at end of file
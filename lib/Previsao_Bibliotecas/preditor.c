@@ -0,0 +1,141 @@
+#include "preditor.h"
+
+#define Q16 16
+#define NIVEL_MAX 10000             // 100,00%
+
+void preditor_iniciar_linear(preditor_t *p, uint16_t *janela, uint16_t capacidade) {
+    p->tipo = PREDITOR_LINEAR;
+    p->ultimo = 0;
+    tendencia_iniciar(&p->m.linear, janela, capacidade);
+}
+
+void preditor_iniciar_holt(preditor_t *p, uint8_t alfa_shift, uint8_t beta_shift) {
+    if (alfa_shift > 15) alfa_shift = 15;
+    if (beta_shift > 15) beta_shift = 15;
+    p->tipo = PREDITOR_HOLT;
+    p->ultimo = 0;
+    p->m.holt.nivel = 0;
+    p->m.holt.taxa = 0;
+    p->m.holt.alfa_shift = alfa_shift;
+    p->m.holt.beta_shift = beta_shift;
+    p->m.holt.iniciado = false;
+}
+
+void preditor_iniciar_kalman(preditor_t *p, float desvio_processo, float desvio_medida) {
+    p->tipo = PREDITOR_KALMAN;
+    p->ultimo = 0;
+    p->m.kalman.nivel = 0.0f;
+    p->m.kalman.taxa = 0.0f;
+    p->m.kalman.p00 = p->m.kalman.p01 = p->m.kalman.p11 = 0.0f;
+    p->m.kalman.q = desvio_processo * desvio_processo;
+    p->m.kalman.r = desvio_medida * desvio_medida;
+    p->m.kalman.iniciado = false;
+}
+
+static void holt_atualizar(preditor_holt_t *h, uint16_t nivel) {
+    int32_t y = (int32_t)nivel << Q16;
+    if (!h->iniciado) {
+        h->nivel = y;
+        h->taxa = 0;
+        h->iniciado = true;
+        return;
+    }
+    // Deslocamentos aritméticos (GCC) fazem o papel das multiplicações por alfa e beta
+    int32_t anterior = h->nivel;
+    int32_t estimado = h->nivel + h->taxa;
+    h->nivel = estimado + ((y - estimado) >> h->alfa_shift);
+    h->taxa += ((h->nivel - anterior) - h->taxa) >> h->beta_shift;
+}
+
+static void kalman_atualizar(preditor_kalman_t *k, uint16_t nivel) {
+    float y = (float)nivel;
+    if (!k->iniciado) {
+        k->nivel = y;
+        k->taxa = 0.0f;
+        k->p00 = k->r;
+        k->p01 = 0.0f;
+        k->p11 = k->r;
+        k->iniciado = true;
+        return;
+    }
+
+    // Predição: F = [1 1; 0 1], Q = q * [1/4 1/2; 1/2 1] (aceleração branca, dt = 1 leitura)
+    k->nivel += k->taxa;
+    k->p00 += 2.0f * k->p01 + k->p11 + 0.25f * k->q;
+    k->p01 += k->p11 + 0.5f * k->q;
+    k->p11 += k->q;
+
+    // Correção com a medida de nível (H = [1 0])
+    float s = k->p00 + k->r;
+    float k0 = k->p00 / s;
+    float k1 = k->p01 / s;
+    float inovacao = y - k->nivel;
+    k->nivel += k0 * inovacao;
+    k->taxa += k1 * inovacao;
+    k->p11 -= k1 * k->p01;
+    k->p01 -= k0 * k->p01;
+    k->p00 -= k0 * k->p00;
+}
+
+void preditor_atualizar(preditor_t *p, uint16_t nivel) {
+    p->ultimo = nivel;
+    switch (p->tipo) {
+    case PREDITOR_LINEAR:
+        tendencia_adicionar(&p->m.linear, nivel);
+        break;
+    case PREDITOR_HOLT:
+        holt_atualizar(&p->m.holt, nivel);
+        break;
+    case PREDITOR_KALMAN:
+        kalman_atualizar(&p->m.kalman, nivel);
+        break;
+    }
+}
+
+uint16_t preditor_prever(const preditor_t *p, uint32_t horizonte, uint16_t chuva_mmh) {
+    int32_t previsto = p->ultimo;
+    switch (p->tipo) {
+    case PREDITOR_LINEAR:
+        previsto = tendencia_projetar(&p->m.linear, p->ultimo, horizonte);
+        break;
+    case PREDITOR_HOLT: {
+        int64_t v = (int64_t)p->m.holt.nivel + (int64_t)p->m.holt.taxa * horizonte;
+        previsto = (int32_t)((v + (1 << (Q16 - 1))) >> Q16);
+        break;
+    }
+    case PREDITOR_KALMAN: {
+        float v = p->m.kalman.nivel + p->m.kalman.taxa * (float)horizonte;
+        if (v < 0.0f) v = 0.0f;
+        else if (v > (float)NIVEL_MAX) v = (float)NIVEL_MAX;
+        previsto = (int32_t)(v + 0.5f);
+        break;
+    }
+    }
+    previsto += chuva_mmh / PREDITOR_DIVISOR_CHUVA;
+
+    if (previsto < 0) previsto = 0;
+    else if (previsto > NIVEL_MAX) previsto = NIVEL_MAX;
+    return (uint16_t)previsto;
+}
+
+size_t preditor_ram(const preditor_t *p) {
+    size_t base = offsetof(preditor_t, m);
+    switch (p->tipo) {
+    case PREDITOR_LINEAR:
+        return base + sizeof(tendencia_t) + p->m.linear.capacidade * sizeof(uint16_t);
+    case PREDITOR_HOLT:
+        return base + sizeof(preditor_holt_t);
+    case PREDITOR_KALMAN:
+        return base + sizeof(preditor_kalman_t);
+    }
+    return sizeof(preditor_t);
+}
+
+const char *preditor_nome(preditor_tipo_t tipo) {
+    switch (tipo) {
+    case PREDITOR_LINEAR: return "linear";
+    case PREDITOR_HOLT:   return "holt";
+    case PREDITOR_KALMAN: return "kalman";
+    }
+    return "?";
+}
@@ -0,0 +1,69 @@
+#ifndef PREDITOR_H
+#define PREDITOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "tendencia.h"
+
+/* ---------- Preditores de nível ----------
+ * Interface comum chamada por tarefa_previsao: cada leitura de nível entra em
+ * preditor_atualizar e preditor_prever projeta 'horizonte' leituras à frente.
+ * Todos os modelos somam o mesmo impacto da chuva (mm/h / PREDITOR_DIVISOR_CHUVA
+ * em pontos percentuais) e saturam em 0-100%. Nível em centésimos de %.
+ *
+ *  - Linear: tendência da regressão incremental (tendencia.h) sobre a janela.
+ *  - Holt: suavização exponencial dupla (nível e taxa), Q16, alfa = 1/2^a, beta = 1/2^b.
+ *  - Kalman: modelo de velocidade constante com estado [nível, taxa] e covariância
+ *    2x2. É o único em ponto flutuante; o custo por atualização é medido em
+ *    bench_previsao (alvo) e no backtest de host.
+ */
+#define PREDITOR_DIVISOR_CHUVA 10   // 0,1 ponto percentual por mm/h
+
+typedef enum {
+    PREDITOR_LINEAR = 0,
+    PREDITOR_HOLT,
+    PREDITOR_KALMAN
+} preditor_tipo_t;
+
+typedef struct {
+    int32_t nivel;                  // Q16, centésimos de %
+    int32_t taxa;                   // Q16, centésimos de % por leitura
+    uint8_t alfa_shift;
+    uint8_t beta_shift;
+    bool iniciado;
+} preditor_holt_t;
+
+typedef struct {
+    float nivel;                    // Centésimos de %
+    float taxa;                     // Centésimos de % por leitura
+    float p00, p01, p11;            // Covariância do estado (simétrica)
+    float q;                        // Variância da aceleração por leitura
+    float r;                        // Variância da medida
+    bool iniciado;
+} preditor_kalman_t;
+
+typedef struct {
+    preditor_tipo_t tipo;
+    uint16_t ultimo;                // Última leitura recebida
+    union {
+        tendencia_t linear;
+        preditor_holt_t holt;
+        preditor_kalman_t kalman;
+    } m;
+} preditor_t;
+
+/* ---------- API ---------- */
+void preditor_iniciar_linear(preditor_t *p, uint16_t *janela, uint16_t capacidade);
+void preditor_iniciar_holt(preditor_t *p, uint8_t alfa_shift, uint8_t beta_shift);
+// Desvios em centésimos de %: aceleração do processo por leitura e ruído da medida
+void preditor_iniciar_kalman(preditor_t *p, float desvio_processo, float desvio_medida);
+
+void preditor_atualizar(preditor_t *p, uint16_t nivel);
+uint16_t preditor_prever(const preditor_t *p, uint32_t horizonte, uint16_t chuva_mmh);
+
+// Bytes de RAM usados pelo modelo, incluindo a janela externa do linear
+size_t preditor_ram(const preditor_t *p);
+const char *preditor_nome(preditor_tipo_t tipo);
+
+#endif /* PREDITOR_H */
@@ -0,0 +1,61 @@
+#include "tendencia.h"
+
+void tendencia_iniciar(tendencia_t *t, uint16_t *buffer, uint16_t capacidade) {
+    if (capacidade < 2) capacidade = 2;
+    if (capacidade > TENDENCIA_JANELA_MAX) capacidade = TENDENCIA_JANELA_MAX;
+    t->janela = buffer;
+    t->capacidade = capacidade;
+    t->pos = 0;
+    t->contagem = 0;
+    t->soma_y = 0;
+    t->soma_xy = 0;
+}
+
+void tendencia_adicionar(tendencia_t *t, uint16_t amostra) {
+    uint32_t n = t->contagem;
+
+    if (n < t->capacidade) {
+        // Janela enchendo: a nova amostra entra com x = n
+        uint32_t fim = t->pos + n;
+        if (fim >= t->capacidade) fim -= t->capacidade;
+        t->janela[fim] = amostra;
+        t->soma_xy += (int64_t)n * amostra;
+        t->soma_y += amostra;
+        t->contagem = (uint16_t)(n + 1);
+        return;
+    }
+
+    // Janela cheia: sai x = 0, as demais descem uma posição e a nova entra com x = n - 1
+    //   Σxy' = Σxy - (Σy - y_saindo) + (n - 1) * y_novo
+    uint16_t saindo = t->janela[t->pos];
+    t->janela[t->pos] = amostra;
+    if (++t->pos == t->capacidade) t->pos = 0;
+
+    t->soma_y -= saindo;
+    t->soma_xy -= t->soma_y;
+    t->soma_xy += (int64_t)(n - 1) * amostra;
+    t->soma_y += amostra;
+}
+
+int32_t tendencia_inclinacao_q12(const tendencia_t *t) {
+    int64_t n = t->contagem;
+    if (n < 2) return 0;
+
+    // Σx = n(n-1)/2; n*Σx² - (Σx)² = n²(n²-1)/12
+    int64_t soma_x = n * (n - 1) / 2;
+    int64_t numerador = n * t->soma_xy - soma_x * t->soma_y;
+    int64_t denominador = n * n * (n * n - 1) / 12;
+
+    // Arredonda para o mais próximo nos dois sinais
+    int64_t escalado = numerador * (1 << TENDENCIA_FRAC_BITS);
+    if (escalado >= 0) escalado += denominador / 2;
+    else escalado -= denominador / 2;
+    return (int32_t)(escalado / denominador);
+}
+
+int32_t tendencia_projetar(const tendencia_t *t, uint16_t atual, uint32_t horizonte) {
+    int64_t delta = (int64_t)tendencia_inclinacao_q12(t) * horizonte;
+    if (delta >= 0) delta += 1 << (TENDENCIA_FRAC_BITS - 1);
+    else delta -= 1 << (TENDENCIA_FRAC_BITS - 1);
+    return (int32_t)atual + (int32_t)(delta / (1 << TENDENCIA_FRAC_BITS));
+}
@@ -0,0 +1,35 @@
+#ifndef TENDENCIA_H
+#define TENDENCIA_H
+
+#include <stdint.h>
+
+/* ---------- Regressão linear incremental ----------
+ * Ajusta y = a + b*x sobre as últimas N amostras (x = 0 na mais antiga).
+ * Σy e Σxy são mantidas com inteiros de 64 bits e atualizadas quando uma
+ * amostra entra e outra sai; Σx e Σx² saem de fórmula fechada. Como as somas
+ * são exatas não há deriva, e o custo por amostra é O(1) para qualquer N.
+ * Amostras em centésimos de % (0-10000, ver sensor.h).
+ */
+#define TENDENCIA_JANELA_MAX 8192   // Limite para (num << 12) caber em int64
+#define TENDENCIA_FRAC_BITS 12      // Inclinação em Q12
+
+typedef struct {
+    uint16_t *janela;               // Buffer circular fornecido pelo chamador
+    uint16_t capacidade;            // N máximo da janela
+    uint16_t pos;                   // Posição da amostra mais antiga
+    uint16_t contagem;              // Amostras válidas
+    int64_t soma_y;                 // Σy
+    int64_t soma_xy;                // Σx*y, x relativo à amostra mais antiga
+} tendencia_t;
+
+/* ---------- API ---------- */
+void tendencia_iniciar(tendencia_t *t, uint16_t *buffer, uint16_t capacidade);
+void tendencia_adicionar(tendencia_t *t, uint16_t amostra);
+
+// Inclinação em centésimos de % por amostra, Q12 (0 com menos de 2 amostras)
+int32_t tendencia_inclinacao_q12(const tendencia_t *t);
+
+// Valor atual mais inclinação * horizonte (em amostras), sem saturação
+int32_t tendencia_projetar(const tendencia_t *t, uint16_t atual, uint32_t horizonte);
+
+#endif /* TENDENCIA_H */
@@ -0,0 +1,114 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include "atividade.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "pico/stdlib.h"
+
+typedef struct {
+    TaskHandle_t tarefa;
+    bool ociosa;                    // Tarefa ociosa do FreeRTOS (uma por núcleo em SMP)
+    uint32_t ocioso_us;             // Tempo acumulado na ociosa, sono incluído (zero nas demais)
+    uint32_t ocioso_anterior_us;    // Valor no relatório anterior
+} atividade_tarefa_t;
+
+// Em SMP os ganchos rodam com o lock do kernel, então a tabela é serializada;
+// a tarefa em execução e o início da fatia são mantidos por núcleo
+static atividade_tarefa_t tarefas[ATIVIDADE_TAREFAS_MAX];
+static uint8_t n_tarefas = 0;
+static atividade_tarefa_t *atual[configNUMBER_OF_CORES];   // Tarefa em execução em cada núcleo
+static uint32_t inicio_us[configNUMBER_OF_CORES];          // Entrada da tarefa atual
+
+static volatile uint32_t despertares = 0;
+static volatile uint32_t sono_us = 0;
+static uint32_t inicio_sono_us = 0;
+
+static uint32_t ultimo_relatorio_us = 0;
+static uint32_t despertares_anterior = 0;
+static uint32_t sono_anterior_us = 0;
+static uint64_t carga_ua_us = 0;            // Carga estimada (µA·µs)
+
+// Executam dentro da troca de contexto: só contadores, nada que bloqueie
+void atividade_entrou(void) {
+    uint nucleo = get_core_num();
+    TaskHandle_t tarefa = xTaskGetCurrentTaskHandle();
+    atividade_tarefa_t *t = NULL;
+    atividade_tarefa_t *anterior = atual[nucleo];  // Ainda a que acabou de sair deste núcleo
+    inicio_us[nucleo] = time_us_32();
+    for (uint8_t i = 0; i < n_tarefas; ++i) {
+        if (tarefas[i].tarefa == tarefa) {
+            t = &tarefas[i];
+            break;
+        }
+    }
+    if (t == NULL && n_tarefas < ATIVIDADE_TAREFAS_MAX) {
+        // Primeira vez que a tarefa roda: as ociosas se chamam "IDLE" ou "IDLE<n>"
+        const char *nome = pcTaskGetName(tarefa);
+        t = &tarefas[n_tarefas++];
+        t->tarefa = tarefa;
+        t->ociosa = nome[0] == 'I' && nome[1] == 'D' && nome[2] == 'L' && nome[3] == 'E';
+    }
+    atual[nucleo] = t;
+    // Trocas entre tarefas da aplicação não acordam a CPU: só conta a saída da ociosa
+    if (anterior != NULL && anterior->ociosa && (t == NULL || !t->ociosa)) despertares++;
+}
+
+void atividade_saiu(void) {
+    uint nucleo = get_core_num();
+    atividade_tarefa_t *t = atual[nucleo];
+    if (t != NULL && t->ociosa) t->ocioso_us += time_us_32() - inicio_us[nucleo];
+}
+
+void atividade_antes_dormir(void) {
+    inicio_sono_us = time_us_32();
+}
+
+void atividade_depois_dormir(void) {
+    sono_us += time_us_32() - inicio_sono_us;
+}
+
+// Converte um intervalo para centésimos de % da janela
+static uint32_t percentual_x100(uint32_t parte_us, uint32_t janela_us) {
+    return (uint32_t)((uint64_t)parte_us * 10000u / janela_us);
+}
+
+void atividade_imprimir(void) {
+    atividade_tarefa_t copia[ATIVIDADE_TAREFAS_MAX];
+
+    taskENTER_CRITICAL();
+    uint32_t agora_us = time_us_32();
+    uint8_t n = n_tarefas;
+    for (uint8_t i = 0; i < n; ++i) {
+        copia[i] = tarefas[i];
+        tarefas[i].ocioso_anterior_us = tarefas[i].ocioso_us;
+    }
+    uint32_t total_despertares = despertares;
+    uint32_t total_sono_us = sono_us;
+    taskEXIT_CRITICAL();
+
+    uint32_t janela_us = agora_us - ultimo_relatorio_us;
+    if (janela_us == 0) janela_us = 1;
+    uint32_t sono_janela_us = total_sono_us - sono_anterior_us;
+    uint32_t ocioso_janela_us = 0;
+    for (uint8_t i = 0; i < n; ++i) {
+        ocioso_janela_us += copia[i].ocioso_us - copia[i].ocioso_anterior_us;
+    }
+    ocioso_janela_us /= configNUMBER_OF_CORES;    // Média dos núcleos
+
+    // Fora do WFI a CPU está ativa, mesmo na tarefa ociosa
+    uint32_t acordado_us = janela_us > sono_janela_us ? janela_us - sono_janela_us : 0;
+    carga_ua_us += (uint64_t)acordado_us * ATIVIDADE_CORRENTE_ATIVO_UA
+                 + (uint64_t)sono_janela_us * ATIVIDADE_CORRENTE_SONO_UA;
+
+    uint32_t por_s = (uint32_t)((uint64_t)(total_despertares - despertares_anterior) * 1000000u / janela_us);
+    uint32_t ocioso = percentual_x100(ocioso_janela_us, janela_us);
+    uint32_t sono = percentual_x100(sono_janela_us, janela_us);
+    printf("atividade: %lu despertares/s, ocioso %lu.%02lu%%, sono %lu.%02lu%%, carga %lu uAh\n",
+           (unsigned long)por_s, (unsigned long)(ocioso / 100), (unsigned long)(ocioso % 100),
+           (unsigned long)(sono / 100), (unsigned long)(sono % 100),
+           (unsigned long)(carga_ua_us / 3600000000ull));
+
+    ultimo_relatorio_us = agora_us;
+    despertares_anterior = total_despertares;
+    sono_anterior_us = total_sono_us;
+}
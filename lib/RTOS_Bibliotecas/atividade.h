@@ -0,0 +1,32 @@
+#ifndef ATIVIDADE_H
+#define ATIVIDADE_H
+
+#include <stdint.h>
+
+/* ---------- Atividade do escalonador ----------
+ * Chamadas pelos ganchos de troca de contexto (traceTASK_SWITCHED_IN/OUT) e de
+ * sono do modo tickless (configPRE/POST_SLEEP_PROCESSING) em FreeRTOSConfig.h.
+ * Cada troca da tarefa ociosa por outra tarefa no mesmo núcleo conta como um
+ * despertar; trocas entre tarefas da aplicação não contam. O tempo é acumulado
+ * só nas tarefas ociosas, e o tempo em WFI à parte, dentro delas. A CPU de
+ * cada tarefa fica no relatório de saúde (saude.h), a partir dos run-time
+ * stats do kernel. Este header é incluído pelo FreeRTOSConfig.h, por isso não
+ * inclui nenhum header do FreeRTOS.
+ */
+#define ATIVIDADE_TAREFAS_MAX 10
+
+// Corrente estimada da placa em cada estado da CPU (µA) para o contador de carga.
+// Valores típicos do RP2040 a 125 MHz; ajustar com medidas da estação
+#define ATIVIDADE_CORRENTE_ATIVO_UA   24000   // Tarefas da aplicação e ociosa sem WFI
+#define ATIVIDADE_CORRENTE_SONO_UA    11000   // WFI entre ticks suprimidos
+
+void atividade_entrou(void);
+void atividade_saiu(void);
+void atividade_antes_dormir(void);
+void atividade_depois_dormir(void);
+
+// Imprime despertares/s, tempo ocioso e tempo em sono desde a chamada anterior,
+// mais a carga estimada acumulada desde o boot
+void atividade_imprimir(void);
+
+#endif /* ATIVIDADE_H */
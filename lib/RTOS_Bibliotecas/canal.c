@@ -0,0 +1,54 @@
+#include <string.h>
+#include "canal.h"
+#include "pico/stdlib.h"
+#include "hardware/sync.h"
+
+void canal_iniciar(canal_t *c, void *armazenamento, size_t tamanho) {
+    c->sequencia = 0;
+    c->carimbo_us = 0;
+    c->valor = armazenamento;
+    c->tamanho = tamanho;
+    c->n_leitores = 0;
+}
+
+bool canal_inscrever(canal_t *c, TaskHandle_t tarefa, uint32_t bit) {
+    taskENTER_CRITICAL();
+    bool ok = c->n_leitores < CANAL_LEITORES_MAX;
+    if (ok) {
+        c->leitores[c->n_leitores].tarefa = tarefa;
+        c->leitores[c->n_leitores].bit = bit;
+        c->n_leitores++;
+    }
+    taskEXIT_CRITICAL();
+    return ok;
+}
+
+void canal_publicar(canal_t *c, const void *valor) {
+    uint32_t seq = c->sequencia;
+    c->sequencia = seq + 1;         // Ímpar: leitores que pegarem a cópia no meio repetem
+    __dmb();
+    memcpy(c->valor, valor, c->tamanho);
+    c->carimbo_us = time_us_32();
+    __dmb();
+    c->sequencia = seq + 2;
+
+    for (uint8_t i = 0; i < c->n_leitores; ++i) {
+        xTaskNotify(c->leitores[i].tarefa, c->leitores[i].bit, eSetBits);
+    }
+}
+
+uint32_t canal_ler(const canal_t *c, void *destino, uint32_t *carimbo_us) {
+    uint32_t antes, depois, carimbo;
+    do {
+        antes = c->sequencia;
+        if (antes & 1) continue;    // Escrita em andamento (só ocorre com o escritor em outro núcleo)
+        __dmb();
+        memcpy(destino, c->valor, c->tamanho);
+        carimbo = c->carimbo_us;
+        __dmb();
+        depois = c->sequencia;
+        if (antes == depois) break;
+    } while (true);
+    if (carimbo_us) *carimbo_us = carimbo;
+    return antes / 2;
+}
@@ -0,0 +1,49 @@
+#ifndef CANAL_H
+#define CANAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* ---------- Canal de último valor ----------
+ * Um escritor, vários leitores. Cada publicação sobrescreve o valor e incrementa
+ * a sequência; quem lê recebe sempre a publicação mais recente, nunca uma fila
+ * de amostras antigas. A leitura é protegida por seqlock: a sequência fica
+ * ímpar durante a escrita e o leitor repete a cópia se ela mudou no meio.
+ * Cada leitor inscrito recebe um bit de notificação (eSetBits) a cada
+ * publicação, que pode esperar junto com outros eventos da própria tarefa em
+ * um único xTaskNotifyWait. Sequência 0 = nada publicado ainda.
+ * Em núcleo único o escritor deve ter prioridade maior ou igual à dos leitores,
+ * para que nenhum leitor interrompa uma escrita e fique repetindo a cópia.
+ */
+#define CANAL_LEITORES_MAX 4
+
+typedef struct {
+    TaskHandle_t tarefa;
+    uint32_t bit;                   // Bit de notificação usado por esta tarefa
+} canal_leitor_t;
+
+typedef struct {
+    volatile uint32_t sequencia;    // Par = estável, ímpar = escrita em andamento
+    volatile uint32_t carimbo_us;   // time_us_32() da última publicação
+    void *valor;                    // Armazenamento fornecido pelo chamador
+    size_t tamanho;
+    uint8_t n_leitores;
+    canal_leitor_t leitores[CANAL_LEITORES_MAX];
+} canal_t;
+
+/* ---------- API ---------- */
+void canal_iniciar(canal_t *c, void *armazenamento, size_t tamanho);
+
+// Inscreve a tarefa para receber 'bit' a cada publicação (false se não houver vaga)
+bool canal_inscrever(canal_t *c, TaskHandle_t tarefa, uint32_t bit);
+
+// Somente o escritor chama; não bloqueia
+void canal_publicar(canal_t *c, const void *valor);
+
+// Copia a última publicação; retorna sua sequência (0 = nada publicado)
+uint32_t canal_ler(const canal_t *c, void *destino, uint32_t *carimbo_us);
+
+#endif /* CANAL_H */
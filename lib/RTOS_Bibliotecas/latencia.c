@@ -0,0 +1,58 @@
+#include <stdio.h>
+#include <string.h>
+#include "latencia.h"
+
+static latencia_t *saidas[LATENCIA_SAIDAS_MAX];
+static uint8_t n_saidas = 0;
+
+// Índice do balde: bit mais significativo e os 2 bits seguintes
+static uint32_t indice_balde(uint32_t v) {
+    if (v < 4) return v;
+    uint32_t msb = 31 - __builtin_clz(v);
+    uint32_t sub = (v >> (msb - LATENCIA_SUBBALDES_LOG2)) & 3;
+    return 4 + (msb - LATENCIA_SUBBALDES_LOG2) * 4 + sub;
+}
+
+// Maior valor que cai no balde 'i'
+static uint32_t limite_balde(uint32_t i) {
+    if (i < 4) return i;
+    uint32_t desloc = (i - 4) / 4;
+    uint32_t sub = (i - 4) % 4;
+    return (uint32_t)((((uint64_t)(4 | sub) + 1) << desloc) - 1);
+}
+
+void latencia_iniciar(latencia_t *h, const char *nome) {
+    memset(h, 0, sizeof(*h));
+    h->nome = nome;
+    if (n_saidas < LATENCIA_SAIDAS_MAX) saidas[n_saidas++] = h;
+}
+
+void latencia_registrar(latencia_t *h, uint32_t atraso_us) {
+    h->baldes[indice_balde(atraso_us)]++;
+    h->contagem++;
+    if (atraso_us > h->maximo_us) h->maximo_us = atraso_us;
+}
+
+uint32_t latencia_percentil(const latencia_t *h, uint32_t pct) {
+    if (h->contagem == 0) return 0;
+    uint32_t alvo = (uint32_t)(((uint64_t)h->contagem * pct + 99) / 100); // Posição arredondada para cima
+    uint32_t acumulado = 0;
+    for (uint32_t i = 0; i < LATENCIA_BALDES; ++i) {
+        acumulado += h->baldes[i];
+        if (acumulado >= alvo) {
+            uint32_t limite = limite_balde(i);
+            return limite < h->maximo_us ? limite : h->maximo_us;
+        }
+    }
+    return h->maximo_us;
+}
+
+void latencia_imprimir(void) {
+    printf("latencia;saida;amostras;p50_us;p99_us;max_us\n");
+    for (uint8_t i = 0; i < n_saidas; ++i) {
+        const latencia_t *h = saidas[i];
+        printf("latencia;%s;%lu;%lu;%lu;%lu\n", h->nome, (unsigned long)h->contagem,
+               (unsigned long)latencia_percentil(h, 50), (unsigned long)latencia_percentil(h, 99),
+               (unsigned long)h->maximo_us);
+    }
+}
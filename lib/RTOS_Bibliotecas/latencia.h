@@ -0,0 +1,37 @@
+#ifndef LATENCIA_H
+#define LATENCIA_H
+
+#include <stdint.h>
+
+/* ---------- Histograma de latência ----------
+ * Baldes logarítmicos com 4 subdivisões por potência de 2: erro relativo de
+ * no máximo 25% em qualquer escala, de 1 us a 71 minutos, em 496 bytes.
+ * Valores 0-3 us têm balde próprio. Os percentis são o limite superior do
+ * balde em que caem; o máximo é exato.
+ * Um único escritor por histograma (tarefa ou IRQ); a impressão lê sem travar
+ * e pode ver uma amostra a mais ou a menos em contagem e baldes.
+ */
+#define LATENCIA_SUBBALDES_LOG2 2
+#define LATENCIA_BALDES (4 + (32 - LATENCIA_SUBBALDES_LOG2) * 4)
+#define LATENCIA_SAIDAS_MAX 6
+
+typedef struct {
+    const char *nome;
+    uint32_t baldes[LATENCIA_BALDES];
+    uint32_t contagem;
+    uint32_t maximo_us;
+} latencia_t;
+
+/* ---------- API ---------- */
+// Zera o histograma e o inclui em latencia_imprimir
+void latencia_iniciar(latencia_t *h, const char *nome);
+
+void latencia_registrar(latencia_t *h, uint32_t atraso_us);
+
+// Limite superior do balde que contém o percentil 'pct' (1-100); 0 sem amostras
+uint32_t latencia_percentil(const latencia_t *h, uint32_t pct);
+
+// Uma linha por histograma iniciado: amostras, p50, p99 e máximo
+void latencia_imprimir(void);
+
+#endif /* LATENCIA_H */
@@ -0,0 +1,76 @@
+#include <stdio.h>
+#include "perfil_pilhas.h"
+#include "timers.h"
+#include "pico/stdlib.h"
+
+#if MODO_PERFIL_PILHAS
+
+// Leitura de 16 bits para um percentual inteiro
+#define PERFIL_PCT(p) ((uint16_t)((p) * 65535u / 100u))
+
+typedef struct {
+    uint8_t nivel_pct, chuva_pct;
+} perfil_condicao_t;
+
+// Todas as combinações de limiar de main.c (70/95 % no nível, 80 % na chuva)
+// e os extremos, que dão os textos mais longos nas telas
+static const perfil_condicao_t roteiro[] = {
+    {10, 10},     // Sem alerta: LED verde, silêncio, matriz apagada
+    {10, 90},     // Chuva intensa: dois beeps, sequência de chuva na matriz
+    {80, 10},     // Nível alto: beep intermitente, "X"
+    {80, 90},     // Nível alto e chuva: tom prioritário
+    {98, 10},     // Nível crítico: LED vermelho piscando
+    {98, 90},
+    {100, 100},
+    {0, 0},
+};
+
+typedef struct {
+    TaskHandle_t tarefa;
+    uint32_t palavras;
+} perfil_tarefa_t;
+
+static perfil_tarefa_t tarefas[PERFIL_TAREFAS_MAX];
+static uint8_t n_tarefas = 0;
+static uint8_t passos_por_condicao = 1;
+static uint32_t leitura = 0;            // Leituras desde o início da volta atual
+
+// Executa na tarefa de timers, longe das pilhas medidas
+static void perfil_imprimir(void *parametro1, uint32_t volta) {
+    printf("perfil;volta;%lu\n", (unsigned long)volta);
+    printf("pilha;nome;alocada;livre_min;usada\n");
+    for (uint8_t i = 0; i < n_tarefas; ++i) {
+        UBaseType_t livre = uxTaskGetStackHighWaterMark(tarefas[i].tarefa);
+        printf("pilha;%s;%lu;%lu;%lu\n", pcTaskGetName(tarefas[i].tarefa), (unsigned long)tarefas[i].palavras,
+               (unsigned long)livre, (unsigned long)(tarefas[i].palavras - livre));
+    }
+}
+
+void perfil_pilhas_iniciar(uint8_t passos) {
+    passos_por_condicao = passos ? passos : 1;
+}
+
+void perfil_pilhas_registrar(TaskHandle_t tarefa, uint32_t palavras) {
+    if (n_tarefas >= PERFIL_TAREFAS_MAX || tarefa == NULL) return;
+    tarefas[n_tarefas].tarefa = tarefa;
+    tarefas[n_tarefas].palavras = palavras;
+    n_tarefas++;
+}
+
+bool perfil_pilhas_passo(uint16_t *nivel16, uint16_t *chuva16) {
+    static uint32_t volta = 0;
+    uint32_t passo = leitura / PERFIL_LEITURAS_POR_PASSO;
+    const perfil_condicao_t *c = &roteiro[passo / passos_por_condicao];
+    *nivel16 = PERFIL_PCT(c->nivel_pct);
+    *chuva16 = PERFIL_PCT(c->chuva_pct);
+
+    bool novo_passo = leitura % PERFIL_LEITURAS_POR_PASSO == 0;
+    if (++leitura == count_of(roteiro) * passos_por_condicao * PERFIL_LEITURAS_POR_PASSO) {
+        // Fim da volta: as folgas só diminuem, então cada relatório vale para todas as voltas até ali
+        leitura = 0;
+        xTimerPendFunctionCall(perfil_imprimir, NULL, ++volta, 0);
+    }
+    return novo_passo;
+}
+
+#endif /* MODO_PERFIL_PILHAS */
@@ -0,0 +1,37 @@
+#ifndef PERFIL_PILHAS_H
+#define PERFIL_PILHAS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "FreeRTOS.h"
+#include "task.h"
+
+/* ---------- Perfil de pilhas (MODO_PERFIL_PILHAS) ----------
+ * As tarefas rodam com pilhas folgadas (PERFIL_PILHA_PALAVRAS) e a medição
+ * troca as leituras dos sensores por um roteiro que passa por todas as
+ * condições de alerta (LEDs, tons do buzzer e sequências da matriz). Cada
+ * condição dura um passo por tela, e a cada passo a tela do display avança,
+ * então toda tela é desenhada em toda condição.
+ * Ao fim de cada volta do roteiro, a tarefa de timers imprime a menor folga
+ * de cada tarefa registrada:
+ *   pilha;nome;alocada;livre_min;usada       (em palavras)
+ * tools/gerar_pilhas.py converte essas linhas em generated/pilhas.h, que
+ * main.c usa no lugar dos tamanhos escolhidos à mão quando existe.
+ * As callbacks dos alarmes (animacao.c, sinais.c) e as IRQs usam a pilha de
+ * exceções, que esta medida não cobre.
+ */
+#define PERFIL_PILHA_PALAVRAS 2048      // Pilha de cada tarefa durante o perfil
+#define PERFIL_TAREFAS_MAX 8
+#define PERFIL_LEITURAS_POR_PASSO 4     // 1 s por passo a 4 leituras/s (debounce do botão é 200 ms)
+
+// passos_por_condicao: quantidade de telas, para cada condição passar por todas
+void perfil_pilhas_iniciar(uint8_t passos_por_condicao);
+
+// Tarefa medida; palavras é o tamanho com que ela foi criada
+void perfil_pilhas_registrar(TaskHandle_t tarefa, uint32_t palavras);
+
+// Chamada a cada leitura: troca nível e chuva (16 bits normalizados) pelos do
+// roteiro e devolve true quando começa um passo novo (hora de trocar de tela)
+bool perfil_pilhas_passo(uint16_t *nivel16, uint16_t *chuva16);
+
+#endif /* PERFIL_PILHAS_H */
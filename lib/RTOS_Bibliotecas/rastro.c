@@ -0,0 +1,68 @@
+#include <stdio.h>
+#include <stdbool.h>
+#include "rastro.h"
+#include "saude.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "pico/stdlib.h"
+
+static rastro_evento_t eventos[RASTRO_EVENTOS];
+static uint32_t total = 0;                      // Eventos gravados desde o boot
+static volatile bool suspenso = false;
+
+// Tarefas numeradas na primeira execução (vTaskSetTaskNumber), índice = número - 1
+static TaskHandle_t tarefas[RASTRO_TAREFAS_MAX];
+static uint8_t n_tarefas = 0;
+
+void rastro_evento(uint8_t tipo, uint32_t objeto) {
+    if (suspenso) return;
+    UBaseType_t salvo = taskENTER_CRITICAL_FROM_ISR();
+    rastro_evento_t *e = &eventos[total++ & (RASTRO_EVENTOS - 1)];
+    e->tempo_us = time_us_32();
+    e->tipo = tipo;
+    e->nucleo = (uint8_t)get_core_num();
+    e->objeto = (uint16_t)objeto;
+    taskEXIT_CRITICAL_FROM_ISR(salvo);
+}
+
+void rastro_tarefa_entrou(void) {
+    TaskHandle_t tarefa = xTaskGetCurrentTaskHandle();
+    UBaseType_t numero = uxTaskGetTaskNumber(tarefa);
+    if (numero == 0 && n_tarefas < RASTRO_TAREFAS_MAX) {
+        tarefas[n_tarefas++] = tarefa;
+        numero = n_tarefas;
+        vTaskSetTaskNumber(tarefa, numero);
+    }
+    rastro_evento(RASTRO_TAREFA_ENTROU, numero);
+}
+
+void rastro_fila(uint8_t tipo, uint32_t numero_fila) {
+    if (numero_fila != 0) rastro_evento(tipo, numero_fila);  // Semáforos e fila dos timers ficam de fora
+}
+
+void rastro_imprimir(void) {
+    suspenso = true;
+    uint32_t n = total < RASTRO_EVENTOS ? total : RASTRO_EVENTOS;
+    uint32_t primeiro = total - n;
+
+    printf("rastro;inicio;%lu;%lu;%u\n", (unsigned long)n, (unsigned long)primeiro, (unsigned)configNUMBER_OF_CORES);
+    for (uint8_t i = 0; i < n_tarefas; ++i) {
+        printf("rastro;tarefa;%u;%s\n", (unsigned)(i + 1), pcTaskGetName(tarefas[i]));
+    }
+    for (uint32_t i = 1; i <= SAUDE_FILAS_MAX; ++i) {
+        const char *nome = saude_nome_fila(i);
+        if (nome != NULL) printf("rastro;fila;%lu;%s\n", (unsigned long)i, nome);
+    }
+
+    // 16 eventos (128 bytes) por linha, na ordem da memória (little-endian)
+    for (uint32_t i = 0; i < n; i += 16) {
+        printf("rastro;dados;");
+        for (uint32_t j = i; j < n && j < i + 16; ++j) {
+            const uint8_t *b = (const uint8_t *)&eventos[(primeiro + j) & (RASTRO_EVENTOS - 1)];
+            for (uint32_t k = 0; k < sizeof(rastro_evento_t); ++k) printf("%02x", b[k]);
+        }
+        printf("\n");
+    }
+    printf("rastro;fim\n");
+    suspenso = false;
+}
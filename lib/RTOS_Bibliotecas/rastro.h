@@ -0,0 +1,49 @@
+#ifndef RASTRO_H
+#define RASTRO_H
+
+#include <stdint.h>
+
+/* ---------- Rastro do escalonador ----------
+ * Gravador contínuo em RAM alimentado pelos ganchos de trace do FreeRTOS
+ * (FreeRTOSConfig.h). Cada evento tem 8 bytes fixos; o anel guarda os
+ * RASTRO_EVENTOS mais recentes, sobrescrevendo os antigos. Nem todo gancho
+ * roda em seção crítica: traceTASK_DELAY e traceBLOCKING_ON_QUEUE_* rodam com
+ * o escalonador suspenso e as interrupções ligadas, e uma fila usada por uma
+ * ISR pode gravar no meio deles. Por isso cada evento é gravado dentro de
+ * taskENTER_CRITICAL_FROM_ISR: no núcleo único, só o mascaramento das
+ * interrupções (poucos ciclos no M0+); em SMP, também o lock de ISR do
+ * kernel, que é recursivo e já está tomado nos ganchos de seção crítica.
+ * 'r' no terminal imprime o anel em hexadecimal; tools/rastro_perfetto.py
+ * converte a saída para o formato JSON do Chrome/Perfetto.
+ * Como atividade.h, não inclui headers do FreeRTOS.
+ */
+#define RASTRO_EVENTOS 1024             // Potência de 2 (8 KB)
+#define RASTRO_TAREFAS_MAX 15
+
+typedef enum {
+    RASTRO_TAREFA_ENTROU = 1,           // objeto = tarefa (a saída fica implícita na próxima entrada)
+    RASTRO_FILA_ENVIO,                  // objeto = fila (número de saude_registrar_fila)
+    RASTRO_FILA_RECEBIDO,
+    RASTRO_FILA_BLOQUEIO_ENVIO,         // Tarefa atual vai esperar espaço na fila
+    RASTRO_FILA_BLOQUEIO_RECEBE,        // Tarefa atual vai esperar dado na fila
+    RASTRO_NOTIFICACAO_BLOQUEIO,        // Tarefa atual vai esperar em xTaskNotifyWait/ulTaskNotifyTake
+    RASTRO_ATRASO                       // Tarefa atual entrou em vTaskDelay
+} rastro_tipo_t;
+
+typedef struct {
+    uint32_t tempo_us;                  // time_us_32()
+    uint8_t tipo;                       // rastro_tipo_t
+    uint8_t nucleo;
+    uint16_t objeto;
+} rastro_evento_t;
+
+// Ganchos (FreeRTOSConfig.h)
+void rastro_tarefa_entrou(void);
+void rastro_evento(uint8_t tipo, uint32_t objeto);
+void rastro_fila(uint8_t tipo, uint32_t numero_fila);
+
+// Imprime tabela de nomes e eventos do mais antigo ao mais recente;
+// a gravação fica suspensa durante a impressão
+void rastro_imprimir(void);
+
+#endif /* RASTRO_H */
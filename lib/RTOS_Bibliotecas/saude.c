@@ -0,0 +1,130 @@
+#include <stdio.h>
+#include "saude.h"
+#include "latencia.h"
+#include "rastro.h"
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+#include "timers.h"
+#include "pico/stdlib.h"
+
+typedef struct {
+    QueueHandle_t fila;
+    const char *nome;
+    volatile uint32_t maximo;       // Maior ocupação vista logo após um envio
+} saude_fila_t;
+
+typedef struct {
+    UBaseType_t numero;             // xTaskNumber
+    configRUN_TIME_COUNTER_TYPE contador;
+} saude_tarefa_t;
+
+static saude_fila_t filas[SAUDE_FILAS_MAX];
+static uint8_t n_filas = 0;
+
+// Contadores do relatório anterior, para a CPU % do intervalo
+static saude_tarefa_t anteriores[SAUDE_TAREFAS_MAX];
+static uint8_t n_anteriores = 0;
+static configRUN_TIME_COUNTER_TYPE total_anterior = 0;
+
+static void (*relatorio_aplicacao)(void) = NULL;
+
+uint64_t saude_contador_us(void) {
+    return time_us_64();
+}
+
+// Roda dentro do kernel (seção crítica do envio): só compara e grava
+void saude_fila_enviada(uint32_t numero, uint32_t aguardando, uint32_t capacidade) {
+    if (numero == 0 || numero > n_filas) return;    // Filas não registradas e semáforos
+    uint32_t ocupacao = aguardando < capacidade ? aguardando + 1 : capacidade;
+    if (ocupacao > filas[numero - 1].maximo) filas[numero - 1].maximo = ocupacao;
+}
+
+void saude_registrar_fila(void *fila, const char *nome) {
+    if (n_filas >= SAUDE_FILAS_MAX) return;
+    filas[n_filas].fila = (QueueHandle_t)fila;
+    filas[n_filas].nome = nome;
+    filas[n_filas].maximo = 0;
+    n_filas++;
+    vQueueSetQueueNumber((QueueHandle_t)fila, n_filas);
+}
+
+const char *saude_nome_fila(uint32_t numero) {
+    return (numero >= 1 && numero <= n_filas) ? filas[numero - 1].nome : NULL;
+}
+
+// Executa na tarefa de timers: consome o que chegou e atende os comandos
+static void saude_comando(void *parametro1, uint32_t parametro2) {
+    int c;
+    while ((c = getchar_timeout_us(0)) != PICO_ERROR_TIMEOUT) {
+        if (c == 's') saude_imprimir();
+        else if (c == 'l') latencia_imprimir();
+        else if (c == 'r') rastro_imprimir();
+    }
+}
+
+// Chamada pelo stdio em contexto de interrupção quando há caracteres recebidos
+static void saude_caracteres_disponiveis(void *parametro) {
+    BaseType_t acordar_tarefa = pdFALSE;
+    xTimerPendFunctionCallFromISR(saude_comando, NULL, 0, &acordar_tarefa);
+    portYIELD_FROM_ISR(acordar_tarefa);
+}
+
+void saude_registrar_relatorio(void (*imprimir)(void)) {
+    relatorio_aplicacao = imprimir;
+}
+
+void saude_iniciar_comandos(void) {
+    stdio_set_chars_available_callback(saude_caracteres_disponiveis, NULL);
+}
+
+static configRUN_TIME_COUNTER_TYPE contador_anterior(UBaseType_t numero) {
+    for (uint8_t i = 0; i < n_anteriores; ++i) {
+        if (anteriores[i].numero == numero) return anteriores[i].contador;
+    }
+    return 0;
+}
+
+void saude_imprimir(void) {
+    TaskStatus_t estados[SAUDE_TAREFAS_MAX];
+    configRUN_TIME_COUNTER_TYPE total;
+    UBaseType_t n = uxTaskGetSystemState(estados, SAUDE_TAREFAS_MAX, &total);
+
+    // Em SMP o tempo total disponível é o de todos os núcleos
+    configRUN_TIME_COUNTER_TYPE janela = (total - total_anterior) * configNUMBER_OF_CORES;
+    if (janela == 0) janela = 1;
+
+    printf("saude;t_us;%llu\n", (unsigned long long)total);
+    printf("tarefa;nome;cpu_pct;pilha_livre_palavras;prioridade\n");
+    for (UBaseType_t i = 0; i < n; ++i) {
+        configRUN_TIME_COUNTER_TYPE usado = estados[i].ulRunTimeCounter - contador_anterior(estados[i].xTaskNumber);
+        uint32_t cpu_x100 = (uint32_t)(usado * 10000u / janela);
+        printf("tarefa;%s;%lu.%02lu;%lu;%lu\n", estados[i].pcTaskName,
+               (unsigned long)(cpu_x100 / 100), (unsigned long)(cpu_x100 % 100),
+               (unsigned long)estados[i].usStackHighWaterMark, (unsigned long)estados[i].uxCurrentPriority);
+    }
+
+    printf("fila;nome;atual;max;capacidade\n");
+    for (uint8_t i = 0; i < n_filas; ++i) {
+        UBaseType_t atual = uxQueueMessagesWaiting(filas[i].fila);
+        printf("fila;%s;%lu;%lu;%lu\n", filas[i].nome, (unsigned long)atual, (unsigned long)filas[i].maximo,
+               (unsigned long)(atual + uxQueueSpacesAvailable(filas[i].fila)));
+    }
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+    printf("heap;livre;minimo\n");
+    printf("heap;%lu;%lu\n", (unsigned long)xPortGetFreeHeapSize(),
+           (unsigned long)xPortGetMinimumEverFreeHeapSize());
+#endif
+
+    if (relatorio_aplicacao != NULL) relatorio_aplicacao();
+
+    // Guarda os contadores para o próximo intervalo
+    n_anteriores = 0;
+    for (UBaseType_t i = 0; i < n && n_anteriores < SAUDE_TAREFAS_MAX; ++i) {
+        anteriores[n_anteriores].numero = estados[i].xTaskNumber;
+        anteriores[n_anteriores].contador = estados[i].ulRunTimeCounter;
+        n_anteriores++;
+    }
+    total_anterior = total;
+}
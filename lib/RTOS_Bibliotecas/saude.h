@@ -0,0 +1,41 @@
+#ifndef SAUDE_H
+#define SAUDE_H
+
+#include <stdint.h>
+
+/* ---------- Saúde do sistema ----------
+ * Coleta contínua e barata, relatório sob demanda:
+ *  - CPU por tarefa: run-time stats do FreeRTOS contados no timer de 1 MHz
+ *  - Menor folga de pilha de cada tarefa (uxTaskGetStackHighWaterMark)
+ *  - Ocupação atual e máxima das filas registradas (gancho traceQUEUE_SEND)
+ *  - Heap livre e menor heap livre desde o boot (não há heap no MODO_ESTATICO)
+ *  - Linhas da aplicação, de um relatório registrado (saude_registrar_relatorio)
+ * O relatório sai pelo stdio (USB/UART) ao receber 's'; 'l' imprime os
+ * histogramas de latência (latencia.h) e 'r' o rastro do escalonador (rastro.h). Como atividade.h, este
+ * header é incluído pelo FreeRTOSConfig.h e não inclui headers do FreeRTOS.
+ */
+#define SAUDE_FILAS_MAX 4
+#define SAUDE_TAREFAS_MAX 12
+
+// Contador de run-time (portGET_RUN_TIME_COUNTER_VALUE): microssegundos desde o boot
+uint64_t saude_contador_us(void);
+
+// Gancho de envio em fila: 'numero' é o uxQueueNumber dado por saude_registrar_fila
+void saude_fila_enviada(uint32_t numero, uint32_t aguardando, uint32_t capacidade);
+
+// Passa a acompanhar a fila (QueueHandle_t) com o nome dado
+void saude_registrar_fila(void *fila, const char *nome);
+
+// Nome da fila registrada com esse número (1 em diante); NULL se não houver
+const char *saude_nome_fila(uint32_t numero);
+
+// Acrescenta ao fim do relatório as linhas impressas por 'imprimir' (roda na tarefa de timers)
+void saude_registrar_relatorio(void (*imprimir)(void));
+
+// Liga os comandos 's', 'l' e 'r' no stdio
+void saude_iniciar_comandos(void);
+
+// Imprime o relatório; CPU % é relativa ao intervalo desde o relatório anterior
+void saude_imprimir(void);
+
+#endif /* SAUDE_H */
@@ -0,0 +1,94 @@
+#include "adc_dma.h"
+#include "hardware/adc.h"
+#include "hardware/dma.h"
+#include "hardware/irq.h"
+#include "hardware/sync.h"
+
+#define ADC_CLOCK_HZ 48000000.0f  // clk_adc; cada conversão leva 96 ciclos
+
+static uint16_t buffer_amostras[2][ADC_DMA_CANAIS * ADC_DMA_DECIMACAO_MAX];
+static int canal_dma[2];
+static uint16_t decimacao_atual;
+static volatile int8_t bloco_pronto = -1;  // Metade completa ainda não decimada (escrita pela IRQ)
+static volatile uint32_t blocos_perdidos = 0;
+static adc_dma_cb_t bloco_cb = NULL;
+static void *bloco_ctx = NULL;
+
+// Fim de uma metade: o canal encadeado já assumiu a outra metade sem lacuna
+static void adc_dma_irq_handler(void) {
+    for (int i = 0; i < 2; ++i) {
+        uint32_t mask = 1u << canal_dma[i];
+        if (!(dma_hw->ints0 & mask)) continue;
+        dma_hw->ints0 = mask;
+        // Rearma o endereço de escrita; a contagem é recarregada no próximo disparo
+        dma_channel_set_write_addr(canal_dma[i], buffer_amostras[i], false);
+        if (bloco_pronto >= 0) blocos_perdidos++;
+        bloco_pronto = i;
+        if (bloco_cb) bloco_cb(bloco_ctx);
+    }
+}
+
+void adc_dma_iniciar(uint pino_adc0, uint pino_adc1, uint32_t taxa_hz, uint16_t decimacao,
+                     adc_dma_cb_t cb, void *ctx) {
+    if (decimacao == 0) decimacao = 1;
+    if (decimacao > ADC_DMA_DECIMACAO_MAX) decimacao = ADC_DMA_DECIMACAO_MAX;
+    decimacao_atual = decimacao;
+    bloco_cb = cb;
+    bloco_ctx = ctx;
+
+    adc_init();
+    adc_gpio_init(pino_adc0);
+    adc_gpio_init(pino_adc1);
+    adc_select_input(0);                     // Round-robin começa no ADC0
+    adc_set_round_robin((1u << ADC_DMA_CANAIS) - 1);
+    adc_fifo_setup(true, true, 1, false, false);  // FIFO com DREQ a cada amostra
+    adc_set_clkdiv(ADC_CLOCK_HZ / (float)(taxa_hz * ADC_DMA_CANAIS) - 1.0f);
+
+    uint32_t amostras_bloco = (uint32_t)ADC_DMA_CANAIS * decimacao;
+    canal_dma[0] = dma_claim_unused_channel(true);
+    canal_dma[1] = dma_claim_unused_channel(true);
+    for (int i = 0; i < 2; ++i) {
+        dma_channel_config c = dma_channel_get_default_config(canal_dma[i]);
+        channel_config_set_transfer_data_size(&c, DMA_SIZE_16);
+        channel_config_set_read_increment(&c, false);
+        channel_config_set_write_increment(&c, true);
+        channel_config_set_dreq(&c, DREQ_ADC);
+        channel_config_set_chain_to(&c, canal_dma[1 - i]);
+        dma_channel_configure(canal_dma[i], &c, buffer_amostras[i], &adc_hw->fifo, amostras_bloco, false);
+        dma_channel_set_irq0_enabled(canal_dma[i], true);
+    }
+    irq_add_shared_handler(DMA_IRQ_0, adc_dma_irq_handler, PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY);
+    irq_set_enabled(DMA_IRQ_0, true);
+
+    adc_fifo_drain();
+    dma_channel_start(canal_dma[0]);
+    adc_run(true);
+}
+
+// Filtro de média (boxcar) seguido de dizimação: soma as amostras do bloco
+// por canal e devolve a média na escala de 16 bits usada por sensor.h
+bool adc_dma_decimar(uint16_t medias16[ADC_DMA_CANAIS]) {
+    // Lê e limpa sem a IRQ no meio: um bloco que chegasse entre as duas
+    // operações seria apagado sem contar como perdido. A IRQ do DMA fica no
+    // núcleo que chamou adc_dma_iniciar, o mesmo da tarefa que decima
+    uint32_t salvo = save_and_disable_interrupts();
+    int8_t b = bloco_pronto;
+    bloco_pronto = -1;
+    restore_interrupts(salvo);
+    if (b < 0) return false;
+
+    uint32_t soma[ADC_DMA_CANAIS] = {0};
+    const uint16_t *p = buffer_amostras[b];
+    for (uint16_t i = 0; i < decimacao_atual; ++i) {
+        for (int ch = 0; ch < ADC_DMA_CANAIS; ++ch) soma[ch] += *p++ & 0x0FFF;
+    }
+    for (int ch = 0; ch < ADC_DMA_CANAIS; ++ch) {
+        uint32_t media = (soma[ch] << 4) / decimacao_atual;  // 0..65520
+        medias16[ch] = (uint16_t)(media + (media >> 12));     // Estica até 65535
+    }
+    return true;
+}
+
+uint32_t adc_dma_blocos_perdidos(void) {
+    return blocos_perdidos;
+}
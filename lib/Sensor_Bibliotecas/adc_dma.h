@@ -0,0 +1,27 @@
+#ifndef ADC_DMA_H
+#define ADC_DMA_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "pico/stdlib.h"
+
+/* ---------- Configuração ----------
+ * O ADC converte continuamente ADC0 e ADC1 em round-robin. Dois canais DMA
+ * encadeados (ping-pong) copiam o FIFO para duas metades de um buffer; cada
+ * metade completa é um bloco com 'decimacao' amostras por canal.
+ */
+#define ADC_DMA_CANAIS          2    // ADC0 (chuva) e ADC1 (nível)
+#define ADC_DMA_DECIMACAO_MAX   512  // Limite de amostras por canal em um bloco
+
+// Callback chamado (em contexto de interrupção) quando um bloco fica pronto
+typedef void (*adc_dma_cb_t)(void *ctx);
+
+/* ---------- API ---------- */
+// pino_adc0/pino_adc1: GPIOs ligados ao ADC0 e ao ADC1; taxa_hz por canal, no mínimo
+// 367 Hz (abaixo disso o divisor de 16 bits do ADC estoura)
+void adc_dma_iniciar(uint pino_adc0, uint pino_adc1, uint32_t taxa_hz, uint16_t decimacao,
+                     adc_dma_cb_t cb, void *ctx);
+bool adc_dma_decimar(uint16_t medias16[ADC_DMA_CANAIS]);  // Média do último bloco por canal (medias16[n] = ADCn), escala de 16 bits
+uint32_t adc_dma_blocos_perdidos(void);  // Blocos sobrescritos antes de serem decimados
+
+#endif /* ADC_DMA_H */
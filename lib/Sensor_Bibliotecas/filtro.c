@@ -0,0 +1,88 @@
+#include "filtro.h"
+
+void filtro_iniciar(filtro_t *f, filtro_tipo_t tipo, uint8_t parametro) {
+    f->tipo = tipo;
+    if (tipo == FILTRO_EMA) {
+        if (parametro > 15) parametro = 15;
+    } else {
+        if (parametro == 0) parametro = 1;
+        if (parametro > FILTRO_JANELA_MAX) parametro = FILTRO_JANELA_MAX;
+    }
+    f->parametro = parametro;
+    f->pos = 0;
+    f->contagem = 0;
+    f->acumulador = 0;
+}
+
+// Troca 'saindo' por 'entrando' no vetor ordenado, deslocando só o trecho entre eles
+static void mediana_substituir(filtro_t *f, uint16_t saindo, uint16_t entrando) {
+    uint8_t n = f->contagem, i = 0;
+    while (i < n && f->ordenada[i] != saindo) ++i;
+    while (i > 0 && f->ordenada[i - 1] > entrando) {
+        f->ordenada[i] = f->ordenada[i - 1];
+        --i;
+    }
+    while (i + 1 < n && f->ordenada[i + 1] < entrando) {
+        f->ordenada[i] = f->ordenada[i + 1];
+        ++i;
+    }
+    f->ordenada[i] = entrando;
+}
+
+// Insere a amostra no vetor ordenado enquanto a janela ainda está enchendo
+static void mediana_inserir(filtro_t *f, uint16_t amostra) {
+    uint8_t i = f->contagem;
+    while (i > 0 && f->ordenada[i - 1] > amostra) {
+        f->ordenada[i] = f->ordenada[i - 1];
+        --i;
+    }
+    f->ordenada[i] = amostra;
+}
+
+uint16_t filtro_atualizar(filtro_t *f, uint16_t amostra) {
+    switch (f->tipo) {
+    case FILTRO_MEDIANA:
+        if (f->contagem < f->parametro) {
+            mediana_inserir(f, amostra);
+            f->contagem++;
+        } else {
+            mediana_substituir(f, f->janela[f->pos], amostra);
+        }
+        f->janela[f->pos] = amostra;
+        if (++f->pos >= f->parametro) f->pos = 0;
+        return f->ordenada[f->contagem / 2];
+
+    case FILTRO_EMA:
+        if (f->contagem == 0) {
+            f->acumulador = (uint32_t)amostra << f->parametro; // Parte do primeiro valor
+            f->contagem = 1;
+        } else {
+            f->acumulador = f->acumulador - (f->acumulador >> f->parametro) + amostra;
+        }
+        return (uint16_t)(f->acumulador >> f->parametro);
+
+    case FILTRO_MEDIA_MOVEL:
+        if (f->contagem < f->parametro) {
+            f->contagem++;
+        } else {
+            f->acumulador -= f->janela[f->pos];
+        }
+        f->acumulador += amostra;
+        f->janela[f->pos] = amostra;
+        if (++f->pos >= f->parametro) f->pos = 0;
+        return (uint16_t)(f->acumulador / f->contagem);
+
+    case FILTRO_NENHUM:
+    default:
+        return amostra;
+    }
+}
+
+const char *filtro_nome(filtro_tipo_t tipo) {
+    switch (tipo) {
+    case FILTRO_MEDIANA:     return "mediana";
+    case FILTRO_EMA:         return "ema";
+    case FILTRO_MEDIA_MOVEL: return "media_movel";
+    default:                 return "nenhum";
+    }
+}
@@ -0,0 +1,34 @@
+#ifndef FILTRO_H
+#define FILTRO_H
+
+#include <stdint.h>
+
+/* ---------- Filtros de fluxo ----------
+ * Operam sobre leituras de 16 bits (escala de sensor.h), só com inteiros.
+ * Custo por amostra: EMA e média móvel O(1); mediana O(N) com N <= FILTRO_JANELA_MAX.
+ */
+#define FILTRO_JANELA_MAX 9
+
+typedef enum {
+    FILTRO_NENHUM = 0,
+    FILTRO_MEDIANA,       // Mediana das últimas N amostras (remove picos isolados)
+    FILTRO_EMA,           // Média exponencial, alfa = 1 / 2^parametro
+    FILTRO_MEDIA_MOVEL    // Média das últimas N amostras com soma corrente
+} filtro_tipo_t;
+
+typedef struct {
+    filtro_tipo_t tipo;
+    uint8_t parametro;                       // N da janela ou shift da EMA
+    uint8_t pos;                             // Próxima posição do buffer circular
+    uint8_t contagem;                        // Amostras válidas na janela
+    uint16_t janela[FILTRO_JANELA_MAX];      // Amostras em ordem de chegada
+    uint16_t ordenada[FILTRO_JANELA_MAX];    // Mesmas amostras ordenadas (mediana)
+    uint32_t acumulador;                     // Soma da janela ou EMA << parametro
+} filtro_t;
+
+/* ---------- API ---------- */
+void filtro_iniciar(filtro_t *f, filtro_tipo_t tipo, uint8_t parametro);
+uint16_t filtro_atualizar(filtro_t *f, uint16_t amostra);
+const char *filtro_nome(filtro_tipo_t tipo);
+
+#endif /* FILTRO_H */
@@ -0,0 +1,62 @@
+// Gerado por tools/gerar_tabelas_sensor.py - não editar
+#ifndef TABELAS_SENSOR_H
+#define TABELAS_SENSOR_H
+
+#include <stdint.h>
+
+#define SENSOR_TABELA_PONTOS 257
+#define SENSOR_TABELA_SHIFT 8  // Bits da entrada abaixo do índice
+
+// Leitura normalizada -> percentual (centésimos de %)
+static const uint16_t tabela_percentual_x100[SENSOR_TABELA_PONTOS] = {
+        0,    39,    78,   117,   156,   195,   234,   273,   312,   352,   391,   430,
+      469,   508,   547,   586,   625,   664,   703,   742,   781,   820,   859,   898,
+      938,   977,  1016,  1055,  1094,  1133,  1172,  1211,  1250,  1289,  1328,  1367,
+     1406,  1445,  1484,  1523,  1562,  1602,  1641,  1680,  1719,  1758,  1797,  1836,
+     1875,  1914,  1953,  1992,  2031,  2070,  2109,  2148,  2188,  2227,  2266,  2305,
+     2344,  2383,  2422,  2461,  2500,  2539,  2578,  2617,  2656,  2695,  2734,  2773,
+     2812,  2852,  2891,  2930,  2969,  3008,  3047,  3086,  3125,  3164,  3203,  3242,
+     3281,  3320,  3359,  3398,  3438,  3477,  3516,  3555,  3594,  3633,  3672,  3711,
+     3750,  3789,  3828,  3867,  3906,  3945,  3984,  4023,  4062,  4102,  4141,  4180,
+     4219,  4258,  4297,  4336,  4375,  4414,  4453,  4492,  4531,  4570,  4609,  4648,
+     4688,  4727,  4766,  4805,  4844,  4883,  4922,  4961,  5000,  5039,  5078,  5117,
+     5156,  5195,  5234,  5273,  5312,  5352,  5391,  5430,  5469,  5508,  5547,  5586,
+     5625,  5664,  5703,  5742,  5781,  5820,  5859,  5898,  5938,  5977,  6016,  6055,
+     6094,  6133,  6172,  6211,  6250,  6289,  6328,  6367,  6406,  6445,  6484,  6523,
+     6562,  6602,  6641,  6680,  6719,  6758,  6797,  6836,  6875,  6914,  6953,  6992,
+     7031,  7070,  7109,  7148,  7188,  7227,  7266,  7305,  7344,  7383,  7422,  7461,
+     7500,  7539,  7578,  7617,  7656,  7695,  7734,  7773,  7812,  7852,  7891,  7930,
+     7969,  8008,  8047,  8086,  8125,  8164,  8203,  8242,  8281,  8320,  8359,  8398,
+     8438,  8477,  8516,  8555,  8594,  8633,  8672,  8711,  8750,  8789,  8828,  8867,
+     8906,  8945,  8984,  9023,  9062,  9102,  9141,  9180,  9219,  9258,  9297,  9336,
+     9375,  9414,  9453,  9492,  9531,  9570,  9609,  9648,  9688,  9727,  9766,  9805,
+     9844,  9883,  9922,  9961, 10000,
+};
+
+// Leitura normalizada -> chuva (centésimos de mm/h)
+static const uint16_t tabela_chuva_mmh_x100[SENSOR_TABELA_PONTOS] = {
+        0,     7,    13,    20,    26,    33,    39,    46,    52,    59,    65,    72,
+       78,    85,    91,    98,   104,   111,   117,   124,   130,   137,   143,   150,
+      156,   163,   169,   176,   182,   189,   195,   202,   208,   215,   221,   228,
+      234,   241,   247,   254,   260,   267,   273,   280,   286,   293,   299,   306,
+      312,   319,   326,   332,   339,   345,   352,   358,   365,   371,   378,   384,
+      391,   397,   404,   410,   417,   423,   430,   436,   443,   449,   456,   462,
+      469,   475,   482,   488,   495,   503,   516,   529,   542,   555,   568,   581,
+      594,   607,   620,   633,   646,   659,   672,   685,   698,   711,   724,   737,
+      750,   763,   776,   789,   802,   815,   828,   841,   854,   867,   880,   893,
+      906,   919,   932,   945,   958,   971,   984,   997,  1010,  1023,  1036,  1049,
+     1062,  1076,  1089,  1102,  1115,  1128,  1141,  1154,  1167,  1180,  1193,  1206,
+     1219,  1232,  1245,  1258,  1271,  1284,  1297,  1310,  1323,  1336,  1349,  1362,
+     1375,  1388,  1401,  1414,  1427,  1440,  1453,  1466,  1479,  1492,  1512,  1541,
+     1570,  1600,  1629,  1658,  1688,  1717,  1746,  1775,  1805,  1834,  1863,  1893,
+     1922,  1951,  1980,  2010,  2039,  2068,  2098,  2127,  2156,  2186,  2215,  2244,
+     2273,  2303,  2332,  2361,  2391,  2420,  2449,  2479,  2508,  2537,  2566,  2596,
+     2625,  2654,  2684,  2713,  2742,  2771,  2801,  2830,  2859,  2889,  2918,  2947,
+     2977,  3003,  3016,  3029,  3042,  3055,  3068,  3081,  3094,  3107,  3120,  3133,
+     3146,  3159,  3172,  3185,  3198,  3211,  3224,  3237,  3250,  3263,  3276,  3289,
+     3302,  3315,  3328,  3341,  3354,  3367,  3380,  3393,  3406,  3419,  3432,  3445,
+     3458,  3471,  3484,  3497,  3500,  3500,  3500,  3500,  3500,  3500,  3500,  3500,
+     3500,  3500,  3500,  3500,  3500,
+};
+
+#endif /* TABELAS_SENSOR_H */
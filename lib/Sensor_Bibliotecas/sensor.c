@@ -0,0 +1,24 @@
+#include "sensor.h"
+#include "generated/tabelas_sensor.h"
+
+// Interpola a tabela gerada entre os dois pontos vizinhos da leitura
+static inline uint16_t interpolar(const uint16_t *tabela, uint16_t leitura16) {
+    uint32_t i = leitura16 >> SENSOR_TABELA_SHIFT;
+    uint32_t frac = leitura16 & ((1u << SENSOR_TABELA_SHIFT) - 1);
+    int32_t a = tabela[i], b = tabela[i + 1];
+    return (uint16_t)(a + (((b - a) * (int32_t)frac) >> SENSOR_TABELA_SHIFT));
+}
+
+// Replica os bits altos nos baixos: 0 -> 0 e 4095 -> 65535
+uint16_t sensor_normalizar_adc(uint16_t raw12) {
+    raw12 &= 0x0FFF;
+    return (uint16_t)((raw12 << 4) | (raw12 >> 8));
+}
+
+uint16_t sensor_percentual_x100(uint16_t leitura16) {
+    return interpolar(tabela_percentual_x100, leitura16);
+}
+
+uint16_t sensor_chuva_mmh_x100(uint16_t leitura16) {
+    return interpolar(tabela_chuva_mmh_x100, leitura16);
+}
@@ -0,0 +1,18 @@
+#ifndef SENSOR_H
+#define SENSOR_H
+
+#include <stdint.h>
+
+/* ---------- Ponto fixo ----------
+ * Percentuais e mm/h circulam em centésimos (uint16_t):
+ * 7000 = 70,00 %, 3500 = 35,00 mm/h. Limiares são comparados como inteiros.
+ */
+#define PCT_X100(p)   ((uint16_t)((p) * 100))   // Constante percentual em centésimos
+#define MMH_X100(v)   ((uint16_t)((v) * 100))   // Constante mm/h em centésimos
+
+/* ---------- API ---------- */
+uint16_t sensor_normalizar_adc(uint16_t raw12);      // Leitura de 12 bits -> escala de 16 bits
+uint16_t sensor_percentual_x100(uint16_t leitura16); // Escala de 16 bits -> centésimos de %
+uint16_t sensor_chuva_mmh_x100(uint16_t leitura16);  // Escala de 16 bits -> centésimos de mm/h
+
+#endif /* SENSOR_H */
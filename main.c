@@ -3,12 +3,27 @@
 #include "pico/stdlib.h"
 #include "hardware/adc.h"
 #include "hardware/i2c.h"
-#include "hardware/pwm.h"  // Biblioteca para suporte a PWM
 #include "FreeRTOS.h"
 #include "task.h"
 #include "queue.h"
+#include "timers.h"
 #include "ssd1306.h"
+#include "telas.h"
 #include "matriz_led.h"
+#include "animacao.h"
+#include "sinais.h"
+#include "sensor.h"
+#include "adc_dma.h"
+#include "filtro.h"
+#include "preditor.h"
+#include "canal.h"
+#include "atividade.h"
+#include "saude.h"
+#include "latencia.h"
+#include "perfil_pilhas.h"
+#if __has_include("generated/pilhas.h")
+#include "generated/pilhas.h"  // Gerado por tools/gerar_pilhas.py a partir de um perfil
+#endif
 
 // --- DEFINIÇÕES DE PINOS E CONSTANTES ---
 #define I2C_PORT i2c1
@@ -24,117 +39,397 @@
 #define LED_VERDE_PIN 11            // Pino do LED verde
 #define BUZZER_PIN 10               // Pino do buzzer
 
+// --- AQUISIÇÃO ---
+// 1: ADC em round-robin contínuo via DMA, com sobreamostragem e média por bloco
+// 0: duas leituras bloqueantes (adc_read) a cada 250ms (usado pela simulação em sim/)
+#ifndef AQUISICAO_DMA
+#define AQUISICAO_DMA 1
+#endif
+#define ADC_TAXA_HZ 1024            // Amostras por segundo em cada canal
+#define ADC_DECIMACAO 256           // Amostras por leitura: 1024 / 256 = 4 leituras/s
+// A parte inteira do divisor do ADC tem 16 bits: 48 MHz / (2 canais * taxa) - 1 < 65536
+_Static_assert(ADC_TAXA_HZ * 2 >= 733, "ADC_TAXA_HZ abaixo de ~366 Hz estoura o divisor do ADC");
+
+// Período nominal entre leituras, referência para o jitter
+#if AQUISICAO_DMA
+#define PERIODO_LEITURA_US (ADC_DECIMACAO * 1000000u / ADC_TAXA_HZ)
+#else
+#define PERIODO_LEITURA_US 250000u
+#endif
+
+// Filtro de fluxo aplicado a cada canal antes da conversão (ver filtro.h)
+#define FILTRO_NIVEL_TIPO FILTRO_MEDIANA
+#define FILTRO_NIVEL_PARAMETRO 5    // Janela de 5 leituras
+#define FILTRO_CHUVA_TIPO FILTRO_EMA
+#define FILTRO_CHUVA_PARAMETRO 2    // alfa = 1/4
+
 // --- ESTRUTURAS DE DADOS ---
+// Percentuais e mm/h em centésimos (ver sensor.h)
 typedef struct {
     uint16_t nivel_agua_raw;        // Valor bruto do nível de água lido pelo ADC
     uint16_t volume_chuva_raw;      // Valor bruto do volume de chuva lido pelo ADC
-    float nivel_agua_percent;       // Nível de água em porcentagem (0-100%)
-    float volume_chuva_percent;     // Volume de chuva em porcentagem (0-100%)
-    float volume_chuva_mmh;         // Volume de chuva convertido para mm/h
+    uint16_t nivel_agua_pct;        // Nível de água (0-10000 = 0-100,00%)
+    uint16_t volume_chuva_pct;      // Volume de chuva (0-10000 = 0-100,00%)
+    uint16_t volume_chuva_mmh;      // Volume de chuva (centésimos de mm/h)
     bool alerta_risco_enchente;     // Indica se há risco de enchente
+    uint32_t instante_us;           // time_us_32() logo após a leitura do ADC
+    uint32_t mudanca_us;            // instante_us da leitura que mudou o estado das saídas
 } dados_sensores_t;
 
 typedef struct {
-    float nivel_agua_previsto;      // Previsão do nível de água em porcentagem
+    uint16_t nivel_agua_previsto;   // Previsão do nível de água (centésimos de %)
 } dados_previsao_t;
 
 // --- FILAS PARA COMUNICAÇÃO ENTRE TAREFAS ---
-static QueueHandle_t fila_dados_sensores = NULL;   // Fila para dados dos sensores
+static QueueHandle_t fila_dados_sensores = NULL;   // Todas as leituras, em ordem (só tarefa_previsao consome)
 static QueueHandle_t fila_dados_exibicao = NULL;   // Fila para dados de previsão
 static QueueHandle_t fila_estado_alerta = NULL;    // Fila para estado de alerta
 
+// --- ALOCAÇÃO (MODO_ESTATICO, ver FreeRTOSConfig.h) ---
+// No modo estático, a pilha e o TCB de cada tarefa e a área de cada fila e do
+// timer são variáveis estáticas com o nome do objeto: entram no .bss e aparecem
+// assim no relatório de memória do link (tools/relatorio_memoria.py)
+#if MODO_ESTATICO
+#define CRIAR_FILA(fila, n, tipo) do {                                                  \
+        static uint8_t area_##fila[(n) * sizeof(tipo)];                                 \
+        static StaticQueue_t estrutura_##fila;                                          \
+        fila = xQueueCreateStatic((n), sizeof(tipo), area_##fila, &estrutura_##fila);   \
+    } while (0)
+#define CRIAR_TAREFA(funcao, nome, palavras, prioridade, handle) do {                   \
+        static StackType_t pilha_##funcao[palavras];                                    \
+        static StaticTask_t tcb_##funcao;                                               \
+        *(handle) = xTaskCreateStatic(funcao, nome, (palavras), NULL, prioridade,       \
+                                      pilha_##funcao, &tcb_##funcao);                   \
+    } while (0)
+#define CRIAR_TIMER(timer, nome, periodo, recarregar, callback) do {                    \
+        static StaticTimer_t estrutura_##timer;                                         \
+        timer = xTimerCreateStatic(nome, periodo, recarregar, NULL, callback,           \
+                                   &estrutura_##timer);                                 \
+    } while (0)
+#else
+#define CRIAR_FILA(fila, n, tipo) \
+    fila = xQueueCreate((n), sizeof(tipo))
+#define CRIAR_TAREFA(funcao, nome, palavras, prioridade, handle) \
+    xTaskCreate(funcao, nome, (palavras), NULL, prioridade, handle)
+#define CRIAR_TIMER(timer, nome, periodo, recarregar, callback) \
+    timer = xTimerCreate(nome, periodo, recarregar, NULL, callback)
+#endif
+
+// --- EVENTOS DAS TAREFAS ---
+// Bits de notificação (eSetBits): cada tarefa espera todos os seus eventos em
+// um único xTaskNotifyWait e só acorda quando algo relevante mudou
+#define NOTIF_AMOSTRA (1u << 0)     // Nova leitura em canal_sensores
+#define NOTIF_BOTAO   (1u << 1)     // Borda de descida do botão A (IRQ do GPIO)
+#define NOTIF_FLUSH   (1u << 2)     // Fim do flush assíncrono do display (IRQ do DMA)
+
+// Afinidade das tarefas no MODO_SMP (máscaras de núcleo)
+#define NUCLEO_AQUISICAO (1u << 0)
+#define NUCLEO_INTERFACE (1u << 1)
+
+#define RELATORIO_ATIVIDADE_MS 10000 // Período do relatório de despertares e tempo ocioso
+
+// Pilhas das tarefas (palavras): as de generated/pilhas.h, quando já houver um
+// perfil (MODO_PERFIL_PILHAS, que roda com todas folgadas); senão, escolhidas à mão.
+// As callbacks dos alarmes (animacao.c, sinais.c) e as IRQs usam a pilha de exceções
+#ifndef PILHA_LEITURA
+#define PILHA_LEITURA (configMINIMAL_STACK_SIZE + 256)
+#define PILHA_PREVISAO (configMINIMAL_STACK_SIZE + 256)
+#define PILHA_BUZZER (configMINIMAL_STACK_SIZE + 256)     // Só escolhe o padrão de sinais.c
+#define PILHA_EXIBICAO (configMINIMAL_STACK_SIZE + 512)
+#define PILHA_MATRIZLED (configMINIMAL_STACK_SIZE + 256)  // Só escolhe a sequência de animacao.c
+#endif
+#if MODO_PERFIL_PILHAS
+#define PILHA(tarefa) PERFIL_PILHA_PALAVRAS
+#else
+#define PILHA(tarefa) PILHA_##tarefa
+#endif
+
+#if configSUPPORT_DYNAMIC_ALLOCATION
+// Tudo o que o boot pede ao heap_4: cada bloco leva 8 bytes de cabeçalho e é
+// alinhado a 8. Uma tarefa são dois blocos (pilha e TCB); uma fila, um bloco
+// com a estrutura e a área. A mensagem da fila de timers (DaemonTaskMessage_t,
+// interna ao timers.c) tem 16 bytes no Cortex-M0+. Com a interoperação de
+// pico_sync, o port do RP2040 cria no boot um grupo de eventos, do heap
+// quando não há alocação estática
+#define HEAP_BLOCO(bytes) ((((bytes) + 8 + 7) / 8) * 8)
+#define HEAP_TAREFA(palavras) (HEAP_BLOCO((palavras) * sizeof(StackType_t)) + HEAP_BLOCO(sizeof(StaticTask_t)))
+#define HEAP_FILA(n, bytes) HEAP_BLOCO(sizeof(StaticQueue_t) + (n) * (bytes))
+#if configSUPPORT_PICO_SYNC_INTEROP && !configSUPPORT_STATIC_ALLOCATION
+#define HEAP_PORTA HEAP_BLOCO(sizeof(StaticEventGroup_t))
+#else
+#define HEAP_PORTA 0
+#endif
+#define HEAP_NECESSARIO (HEAP_TAREFA(PILHA(LEITURA)) + HEAP_TAREFA(PILHA(PREVISAO)) +                 \
+                         HEAP_TAREFA(PILHA(BUZZER)) + HEAP_TAREFA(PILHA(EXIBICAO)) +                 \
+                         HEAP_TAREFA(PILHA(MATRIZLED)) +                                             \
+                         configNUMBER_OF_CORES * HEAP_TAREFA(configMINIMAL_STACK_SIZE) +             \
+                         HEAP_TAREFA(configTIMER_TASK_STACK_DEPTH) +                                 \
+                         HEAP_FILA(10, sizeof(dados_sensores_t)) + HEAP_FILA(5, sizeof(dados_previsao_t)) + \
+                         HEAP_FILA(1, sizeof(bool)) + HEAP_FILA(configTIMER_QUEUE_LENGTH, 16) +      \
+                         HEAP_BLOCO(sizeof(StaticTimer_t)) + HEAP_PORTA)
+// O heap de FreeRTOSConfig.h precisa cobrir o boot com 25 % de folga
+_Static_assert(configTOTAL_HEAP_SIZE >= HEAP_NECESSARIO + HEAP_NECESSARIO / 4,
+               "configTOTAL_HEAP_SIZE abaixo do que o boot aloca + 25 %");
+#endif
+
+// --- BAIXO CONSUMO (MODO_BAIXO_CONSUMO, ver FreeRTOSConfig.h) ---
+// Sem alerta e sem toque no botão, o painel primeiro escurece e depois é desligado
+#define TEMPO_ESCURECER_MS 30000
+#define TEMPO_APAGAR_MS 120000
+#define CONTRASTE_NORMAL 0xFF
+#define CONTRASTE_REDUZIDO 0x10
+
+typedef enum {
+    PAINEL_NORMAL = 0,
+    PAINEL_ESCURECIDO,
+    PAINEL_APAGADO
+} estado_painel_t;
+
+// --- CANAL DA ÚLTIMA LEITURA ---
+// Exibição, matriz e buzzer leem sempre a leitura mais recente (ver canal.h)
+static canal_t canal_sensores;
+static dados_sensores_t ultima_leitura_sensores;   // Armazenamento do canal
+
 // --- VARIÁVEIS GLOBAIS ---
 static ssd1306_t display;                          // Instância do display OLED
+static TaskHandle_t tarefa_exibicao_handle = NULL; // Destino das notificações do botão
+
+// Modelo de previsão (ver preditor.h; comparação em bench/host/backtest_previsao.c)
+#define PREVISAO_MODELO PREDITOR_LINEAR
+#define PREVISAO_HORIZONTE 10             // Leituras à frente projetadas pelo modelo
+#define TAMANHO_HISTORICO 4800            // Linear: 4 leituras/s = 20 minutos (máx. TENDENCIA_JANELA_MAX)
+#define PREVISAO_HOLT_ALFA 5              // Holt: alfa = 1/32
+#define PREVISAO_HOLT_BETA 10             // Holt: beta = 1/1024
+#define PREVISAO_KALMAN_PROCESSO 0.001f   // Kalman: desvio da aceleração (centésimos de % por leitura²)
+#define PREVISAO_KALMAN_MEDIDA 50.0f      // Kalman: desvio da medida (centésimos de %)
 
-// Histórico para previsão (buffer circular)
-#define TAMANHO_HISTORICO 5
-static float historico_nivel_agua[TAMANHO_HISTORICO];    // Histórico de níveis de água
-static float historico_volume_chuva[TAMANHO_HISTORICO];  // Histórico de volumes de chuva
-static int indice_historico = 0;                         // Índice atual do histórico
-static int contagem_historico = 0;                       // Contagem de entradas no histórico
+static uint16_t historico_nivel_agua[TAMANHO_HISTORICO]; // Janela do modelo linear (centésimos de %)
+static preditor_t preditor_nivel;                        // Estado do modelo de previsão
 
 // Buffers para gráficos no display
-#define TAMANHO_GRAFICO 10
-static float dados_grafico_chuva[TAMANHO_GRAFICO];   // Dados de chuva para gráfico
-static float dados_grafico_nivel[TAMANHO_GRAFICO];   // Dados de nível para gráfico
-static int indice_grafico = 0;                       // Índice atual do gráfico
-static int contagem_grafico = 0;                     // Contagem de entradas no gráfico
+// tarefa_medicao escreve na sua cópia e publica o conjunto inteiro em canal_grafico;
+// o display lê um instantâneo coerente mesmo com as tarefas em núcleos diferentes
+typedef telas_grafico_t dados_grafico_t;
+
+static dados_grafico_t grafico_medicao;              // Cópia de trabalho de tarefa_medicao
+static dados_grafico_t grafico_publicado;            // Armazenamento do canal
+static canal_t canal_grafico;
 static uint32_t ultimo_tempo_grafico = 0;            // Última atualização do gráfico
 
+// Jitter do período de leitura: desvio entre inícios consecutivos de tarefa_medicao
+// e PERIODO_LEITURA_US, zerado a cada relatório de atividade
+typedef struct {
+    uint32_t leituras;
+    uint32_t soma_desvio_us;
+    uint32_t desvio_max_us;
+} jitter_t;
+static jitter_t jitter_leitura;
+
+// Latência entre a leitura que muda o estado das saídas e a reação de cada uma
+// (ver classe_saidas); impressa com 'l' no terminal
+static latencia_t latencia_led, latencia_buzzer, latencia_matriz, latencia_oled;
+static volatile uint32_t quadro_mudanca_us = 0; // Mudança contida no flush em andamento (0 = nenhuma)
+
 // --- FUNÇÕES AUXILIARES ---
 
-// Converte percentual de chuva para mm/h baseado em faixas predefinidas
-float percentual_para_mmh(float percentual) {
-    if (percentual <= 0.0f) return 0.0f;
-    else if (percentual < 30.0f) return (percentual / 30.0f) * 5.0f;         // 0-5 mm/h
-    else if (percentual < 60.0f) return 5.0f + ((percentual - 30.0f) / 30.0f) * 10.0f; // 5-15 mm/h
-    else if (percentual < 80.0f) return 15.0f + ((percentual - 60.0f) / 20.0f) * 15.0f; // 15-30 mm/h
-    else if (percentual < 95.0f) return 30.0f + ((percentual - 80.0f) / 15.0f) * 5.0f;  // 30-35 mm/h
-    else return 35.0f; // Máximo de 35 mm/h
+// Sinaliza à tarefa de exibição que o flush assíncrono do display terminou (IRQ do DMA)
+static void display_flush_concluido(void *ctx) {
+    BaseType_t acordar_tarefa = pdFALSE;
+    uint32_t mudanca_us = quadro_mudanca_us;
+    if (mudanca_us != 0) {
+        latencia_registrar(&latencia_oled, time_us_32() - mudanca_us);
+        quadro_mudanca_us = 0;
+    }
+    xTaskNotifyFromISR((TaskHandle_t)ctx, NOTIF_FLUSH, eSetBits, &acordar_tarefa);
+    portYIELD_FROM_ISR(acordar_tarefa);
+}
+
+// Entrega o quadro ao DMA sem bloquear; false se o flush anterior ainda ocupa o barramento.
+// A latência do OLED é medida no fim do flush (display_flush_concluido). Um quadro
+// igual ao do painel não inicia DMA nem tem reação visível: a amostra é descartada
+static bool enviar_quadro(uint32_t *mudanca_quadro_us) {
+    if (!ssd1306_send_data_async(&display)) return false;
+    if (display.bytes_last_flush != 0) quadro_mudanca_us = *mudanca_quadro_us;
+    *mudanca_quadro_us = 0;
+    return true;
+}
+
+// Repassa a borda de descida do botão A à tarefa de exibição (IRQ do GPIO)
+static void botao_pressionado(uint gpio, uint32_t eventos) {
+    (void)eventos;                  // Só a borda de descida está habilitada
+    BaseType_t acordar_tarefa = pdFALSE;
+    if (gpio == BUTTON_A_PIN && tarefa_exibicao_handle != NULL) {
+        xTaskNotifyFromISR(tarefa_exibicao_handle, NOTIF_BOTAO, eSetBits, &acordar_tarefa);
+    }
+    portYIELD_FROM_ISR(acordar_tarefa);
+}
+
+// Imprime despertares, tempo ocioso/em sono e carga estimada (tarefa de timers); CPU por tarefa no relatório de saúde
+static void relatorio_atividade(TimerHandle_t timer) {
+    (void)timer;
+    atividade_imprimir();
+
+    taskENTER_CRITICAL();
+    jitter_t jitter = jitter_leitura;
+    memset(&jitter_leitura, 0, sizeof(jitter_leitura));
+    taskEXIT_CRITICAL();
+    printf("jitter: %lu leituras, desvio medio %lu us, desvio max %lu us\n", (unsigned long)jitter.leituras,
+           (unsigned long)(jitter.leituras ? jitter.soma_desvio_us / jitter.leituras : 0),
+           (unsigned long)jitter.desvio_max_us);
 }
 
-// Liga o buzzer com uma frequência específica usando PWM
-void ligar_buzzer(uint frequency) {
-    uint slice_num = pwm_gpio_to_slice_num(BUZZER_PIN);
-    uint channel = pwm_gpio_to_channel(BUZZER_PIN);
+// Acumula o desvio entre o início desta leitura e o da anterior em relação ao período nominal
+static void registrar_jitter(uint32_t *inicio_anterior_us) {
+    uint32_t agora_us = time_us_32();
+    if (*inicio_anterior_us != 0) {
+        int32_t desvio = (int32_t)(agora_us - *inicio_anterior_us - PERIODO_LEITURA_US);
+        uint32_t desvio_abs = desvio < 0 ? (uint32_t)-desvio : (uint32_t)desvio;
+        taskENTER_CRITICAL();
+        jitter_leitura.leituras++;
+        jitter_leitura.soma_desvio_us += desvio_abs;
+        if (desvio_abs > jitter_leitura.desvio_max_us) jitter_leitura.desvio_max_us = desvio_abs;
+        taskEXIT_CRITICAL();
+    }
+    *inicio_anterior_us = agora_us;
+}
 
-    pwm_set_clkdiv(slice_num, 125.0f); // Define divisor de clock para PWM
-    uint32_t top = 1000000 / frequency - 1; // Calcula valor TOP para a frequência
-    pwm_set_wrap(slice_num, top);
-    pwm_set_chan_level(slice_num, channel, top / 15); // Ciclo de trabalho reduzido
+// Estado que decide LEDs, buzzer e matriz: cada limiar usado por alguma saída é um bit
+static uint8_t classe_saidas(const dados_sensores_t *dados) {
+    uint8_t classe = dados->alerta_risco_enchente;
+    if (dados->nivel_agua_pct >= PCT_X100(70)) classe |= 1u << 1;
+    if (dados->nivel_agua_pct > PCT_X100(70)) classe |= 1u << 2;
+    if (dados->nivel_agua_pct > PCT_X100(95)) classe |= 1u << 3;
+    if (dados->volume_chuva_pct > PCT_X100(80)) classe |= 1u << 4;
+    return classe;
+}
+
+// Registra o atraso até esta saída aplicar uma mudança que ela ainda não tinha visto
+static void registrar_reacao(latencia_t *h, uint32_t *mudanca_vista_us, uint32_t mudanca_us) {
+    if (mudanca_us == *mudanca_vista_us) return;
+    latencia_registrar(h, time_us_32() - mudanca_us);
+    *mudanca_vista_us = mudanca_us;
+}
+
+// Reação da matriz: o primeiro quadro da sequência nova saiu para o PIO (IRQ do alarme de animacao.c)
+static void matriz_quadro_enviado(uint32_t mudanca_us) {
+    latencia_registrar(&latencia_matriz, time_us_32() - mudanca_us);
+}
 
-    gpio_set_function(BUZZER_PIN, GPIO_FUNC_PWM); // Configura pino para PWM
-    pwm_set_enabled(slice_num, true); // Habilita PWM
+// Acorda a tarefa de medição quando um bloco de amostras do ADC fica pronto (IRQ do DMA)
+static void adc_bloco_pronto(void *ctx) {
+    BaseType_t acordar_tarefa = pdFALSE;
+    vTaskNotifyGiveFromISR((TaskHandle_t)ctx, &acordar_tarefa);
+    portYIELD_FROM_ISR(acordar_tarefa);
 }
 
-// Desliga o buzzer e restaura o pino como GPIO
-void desligar_buzzer() {
-    uint slice_num = pwm_gpio_to_slice_num(BUZZER_PIN);
-    pwm_set_enabled(slice_num, false); // Desativa PWM
-    gpio_init(BUZZER_PIN); // Reinicia o pino
-    gpio_set_dir(BUZZER_PIN, GPIO_OUT);
-    gpio_put(BUZZER_PIN, 0); // Garante que o buzzer esteja desligado
+#if MODO_ESTATICO
+// Pilhas e TCBs das tarefas do kernel, pedidas pelo FreeRTOS ao iniciar o escalonador
+void vApplicationGetIdleTaskMemory(StaticTask_t **tcb, StackType_t **pilha, configSTACK_DEPTH_TYPE *palavras) {
+    static StaticTask_t tcb_ociosa;
+    static StackType_t pilha_ociosa[configMINIMAL_STACK_SIZE];
+    *tcb = &tcb_ociosa;
+    *pilha = pilha_ociosa;
+    *palavras = configMINIMAL_STACK_SIZE;
 }
 
+void vApplicationGetTimerTaskMemory(StaticTask_t **tcb, StackType_t **pilha, configSTACK_DEPTH_TYPE *palavras) {
+    static StaticTask_t tcb_timers;
+    static StackType_t pilha_timers[configTIMER_TASK_STACK_DEPTH];
+    *tcb = &tcb_timers;
+    *pilha = pilha_timers;
+    *palavras = configTIMER_TASK_STACK_DEPTH;
+}
+
+#if MODO_SMP
+// Tarefas ociosas dos demais núcleos
+void vApplicationGetPassiveIdleTaskMemory(StaticTask_t **tcb, StackType_t **pilha, configSTACK_DEPTH_TYPE *palavras,
+                                          BaseType_t indice) {
+    static StaticTask_t tcb_ociosas[configNUMBER_OF_CORES - 1];
+    static StackType_t pilha_ociosas[configNUMBER_OF_CORES - 1][configMINIMAL_STACK_SIZE];
+    *tcb = &tcb_ociosas[indice];
+    *pilha = pilha_ociosas[indice];
+    *palavras = configMINIMAL_STACK_SIZE;
+}
+#endif
+#endif
+
 // --- TAREFAS ---
 
 // Tarefa responsável por ler os sensores e atualizar LEDs
 void tarefa_medicao(void *pvParameters) {
     // Inicializa o ADC e os pinos correspondentes
+#if AQUISICAO_DMA
+    adc_dma_iniciar(ADC_JOYSTICK_Y_PIN, ADC_JOYSTICK_X_PIN, ADC_TAXA_HZ, ADC_DECIMACAO,
+                    adc_bloco_pronto, xTaskGetCurrentTaskHandle());
+#else
     adc_init();
     adc_gpio_init(ADC_JOYSTICK_X_PIN);
     adc_gpio_init(ADC_JOYSTICK_Y_PIN);
+#endif
 
-    // Configura os LEDs como saídas
-    gpio_init(LED_PIN);
-    gpio_set_dir(LED_PIN, GPIO_OUT);
-    gpio_put(LED_PIN, 0);
-    gpio_init(LED_VERDE_PIN);
-    gpio_set_dir(LED_VERDE_PIN, GPIO_OUT);
-    gpio_put(LED_VERDE_PIN, 0);
+    // Filtros por canal: um pico isolado não dispara o alerta
+    static filtro_t filtro_nivel, filtro_chuva;
+    filtro_iniciar(&filtro_nivel, FILTRO_NIVEL_TIPO, FILTRO_NIVEL_PARAMETRO);
+    filtro_iniciar(&filtro_chuva, FILTRO_CHUVA_TIPO, FILTRO_CHUVA_PARAMETRO);
 
     dados_sensores_t dados;
-    static uint32_t ultimo_tempo_pisco_led_vermelho = 0;
-    static bool estado_pisco_led_vermelho = false;
+    uint32_t inicio_anterior_us = 0;
+    uint8_t classe_anterior = 0xFF;     // Força a primeira leitura a contar como mudança
+    uint32_t mudanca_us = 0, mudanca_led_us = 0;
 
     while (true) {
+#if AQUISICAO_DMA
+        // Aguarda o próximo bloco e reduz cada canal a uma leitura de 16 bits
+        uint16_t medias16[ADC_DMA_CANAIS];
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(1000));
+        if (!adc_dma_decimar(medias16)) continue;
+        dados.instante_us = time_us_32();
+        registrar_jitter(&inicio_anterior_us);
+        uint16_t nivel16 = medias16[1];    // ADC1
+        uint16_t chuva16 = medias16[0];    // ADC0
+        dados.nivel_agua_raw = nivel16 >> 4;
+        dados.volume_chuva_raw = chuva16 >> 4;
+#else
+        registrar_jitter(&inicio_anterior_us);
+
         // Lê o nível de água (ADC1)
         adc_select_input(1);
         dados.nivel_agua_raw = adc_read();
-        dados.nivel_agua_percent = (dados.nivel_agua_raw / 4095.0f) * 100.0f;
+        uint16_t nivel16 = sensor_normalizar_adc(dados.nivel_agua_raw);
 
         // Lê o volume de chuva (ADC0)
         adc_select_input(0);
         dados.volume_chuva_raw = adc_read();
-        dados.volume_chuva_percent = (dados.volume_chuva_raw / 4095.0f) * 100.0f;
+        dados.instante_us = time_us_32();
+        uint16_t chuva16 = sensor_normalizar_adc(dados.volume_chuva_raw);
+#endif
+        nivel16 = filtro_atualizar(&filtro_nivel, nivel16);
+        chuva16 = filtro_atualizar(&filtro_chuva, chuva16);
+#if MODO_PERFIL_PILHAS
+        // Roteiro do perfil no lugar dos sensores; cada passo mostra a próxima tela
+        if (perfil_pilhas_passo(&nivel16, &chuva16) && tarefa_exibicao_handle != NULL) {
+            xTaskNotify(tarefa_exibicao_handle, NOTIF_BOTAO, eSetBits);
+        }
+#endif
+        dados.nivel_agua_pct = sensor_percentual_x100(nivel16);
+        dados.volume_chuva_pct = sensor_percentual_x100(chuva16);
 
-        // Converte percentual de chuva para mm/h
-        dados.volume_chuva_mmh = percentual_para_mmh(dados.volume_chuva_percent);
+        // Converte a leitura de chuva para mm/h pela tabela gerada
+        dados.volume_chuva_mmh = sensor_chuva_mmh_x100(chuva16);
 
         // Define condição de alerta de enchente
-        dados.alerta_risco_enchente = (dados.nivel_agua_percent >= 70.0f || dados.volume_chuva_percent >= 80.0f);
+        dados.alerta_risco_enchente = (dados.nivel_agua_pct >= PCT_X100(70) || dados.volume_chuva_pct >= PCT_X100(80));
 
-        // Envia dados para as filas
+        // Marca a leitura em que o estado das saídas muda; as saídas medem a reação a partir dela
+        uint8_t classe = classe_saidas(&dados);
+        if (classe != classe_anterior) {
+            mudanca_us = dados.instante_us;
+            classe_anterior = classe;
+        }
+        dados.mudanca_us = mudanca_us;
+
+        // Publica a leitura mais recente e envia a sequência completa para a previsão
+        canal_publicar(&canal_sensores, &dados);
         xQueueSend(fila_dados_sensores, &dados, pdMS_TO_TICKS(10));
         if (fila_estado_alerta != NULL) {
             xQueueOverwrite(fila_estado_alerta, &dados.alerta_risco_enchente);
@@ -143,39 +438,35 @@ void tarefa_medicao(void *pvParameters) {
         // Atualiza os dados do gráfico a cada 2 segundos
         uint32_t tempo_atual = to_ms_since_boot(get_absolute_time());
         if ((tempo_atual - ultimo_tempo_grafico) >= 2000) {
-            dados_grafico_chuva[indice_grafico] = dados.volume_chuva_percent;
-            dados_grafico_nivel[indice_grafico] = dados.nivel_agua_percent;
-            indice_grafico = (indice_grafico + 1) % TAMANHO_GRAFICO;
-            if (contagem_grafico < TAMANHO_GRAFICO) contagem_grafico++;
+            grafico_medicao.chuva[grafico_medicao.indice] = dados.volume_chuva_pct;
+            grafico_medicao.nivel[grafico_medicao.indice] = dados.nivel_agua_pct;
+            grafico_medicao.indice = (grafico_medicao.indice + 1) % TELAS_GRAFICO_PONTOS;
+            if (grafico_medicao.contagem < TELAS_GRAFICO_PONTOS) grafico_medicao.contagem++;
+            canal_publicar(&canal_grafico, &grafico_medicao);
             ultimo_tempo_grafico = tempo_atual;
         }
 
-        // Controle dos LEDs com base nas condições
-        if (dados.nivel_agua_percent > 95.0f) {
-            gpio_put(LED_VERDE_PIN, 0);
-            if ((tempo_atual - ultimo_tempo_pisco_led_vermelho) >= 500) {
-                estado_pisco_led_vermelho = !estado_pisco_led_vermelho;
-                gpio_put(LED_PIN, estado_pisco_led_vermelho);
-                ultimo_tempo_pisco_led_vermelho = tempo_atual;
-            }
-        } else if (dados.nivel_agua_percent < 70.0f && dados.volume_chuva_percent > 80.0f) {
-            gpio_put(LED_VERDE_PIN, 1);
-            gpio_put(LED_PIN, 1);
-            estado_pisco_led_vermelho = false;
-        } else if (dados.nivel_agua_percent >= 70.0f && dados.nivel_agua_percent < 95.0f && dados.volume_chuva_percent > 80.0f) {
-            gpio_put(LED_VERDE_PIN, 0);
-            gpio_put(LED_PIN, 1);
-            estado_pisco_led_vermelho = false;
-        } else if (dados.nivel_agua_percent < 70.0f && dados.volume_chuva_percent <= 80.0f) {
-            gpio_put(LED_VERDE_PIN, 1);
-            gpio_put(LED_PIN, 0);
-            estado_pisco_led_vermelho = false;
+        // Controle dos LEDs com base nas condições; o pisca corre no alarme de sinais.c
+        if (dados.nivel_agua_pct > PCT_X100(95)) {
+            sinais_tocar(SINAL_LED_VERDE, &SINAL_DESLIGADO);
+            sinais_tocar(SINAL_LED_VERMELHO, &SINAL_PISCA_LENTO);
+        } else if (dados.nivel_agua_pct < PCT_X100(70) && dados.volume_chuva_pct > PCT_X100(80)) {
+            sinais_tocar(SINAL_LED_VERDE, &SINAL_LIGADO);
+            sinais_tocar(SINAL_LED_VERMELHO, &SINAL_LIGADO);
+        } else if (dados.nivel_agua_pct >= PCT_X100(70) && dados.nivel_agua_pct < PCT_X100(95) && dados.volume_chuva_pct > PCT_X100(80)) {
+            sinais_tocar(SINAL_LED_VERDE, &SINAL_DESLIGADO);
+            sinais_tocar(SINAL_LED_VERMELHO, &SINAL_LIGADO);
+        } else if (dados.nivel_agua_pct < PCT_X100(70) && dados.volume_chuva_pct <= PCT_X100(80)) {
+            sinais_tocar(SINAL_LED_VERDE, &SINAL_LIGADO);
+            sinais_tocar(SINAL_LED_VERMELHO, &SINAL_DESLIGADO);
         } else {
-            gpio_put(LED_VERDE_PIN, 0);
-            gpio_put(LED_PIN, 0);
-            estado_pisco_led_vermelho = false;
+            sinais_tocar(SINAL_LED_VERDE, &SINAL_DESLIGADO);
+            sinais_tocar(SINAL_LED_VERMELHO, &SINAL_DESLIGADO);
         }
+        registrar_reacao(&latencia_led, &mudanca_led_us, dados.mudanca_us);
+#if !AQUISICAO_DMA
         vTaskDelay(pdMS_TO_TICKS(250)); // Aguarda 250ms antes da próxima leitura
+#endif
     }
 }
 
@@ -183,275 +474,258 @@ void tarefa_medicao(void *pvParameters) {
 void tarefa_previsao(void *pvParameters) {
     dados_sensores_t dados_recebidos;
     dados_previsao_t dados_enviar;
-    const float fator_chuva = 0.1f; // Fator de impacto da chuva na previsão
+
+    switch (PREVISAO_MODELO) {
+    case PREDITOR_HOLT:
+        preditor_iniciar_holt(&preditor_nivel, PREVISAO_HOLT_ALFA, PREVISAO_HOLT_BETA);
+        break;
+    case PREDITOR_KALMAN:
+        preditor_iniciar_kalman(&preditor_nivel, PREVISAO_KALMAN_PROCESSO, PREVISAO_KALMAN_MEDIDA);
+        break;
+    default:
+        preditor_iniciar_linear(&preditor_nivel, historico_nivel_agua, TAMANHO_HISTORICO);
+        break;
+    }
 
     while (true) {
-        if (xQueueReceive(fila_dados_sensores, &dados_recebidos, pdMS_TO_TICKS(100)) == pdPASS) {
-            // Atualiza o histórico de dados
-            historico_nivel_agua[indice_historico] = dados_recebidos.nivel_agua_percent;
-            historico_volume_chuva[indice_historico] = dados_recebidos.volume_chuva_mmh;
-            indice_historico = (indice_historico + 1) % TAMANHO_HISTORICO;
-            if (contagem_historico < TAMANHO_HISTORICO) contagem_historico++;
-
-            // Calcula a tendência (inclinação) do nível de água
-            float inclinacao = 0.0f;
-            if (contagem_historico >= 2) {
-                float soma_x = 0.0f, soma_y = 0.0f, soma_xy = 0.0f, soma_x2 = 0.0f;
-                int n = contagem_historico;
-                for (int i = 0; i < n; i++) {
-                    float x_val = (float)i;
-                    float y_val = historico_nivel_agua[(indice_historico - n + i + TAMANHO_HISTORICO) % TAMANHO_HISTORICO];
-                    soma_x += x_val;
-                    soma_y += y_val;
-                    soma_xy += x_val * y_val;
-                    soma_x2 += x_val * x_val;
-                }
-                float denominador = n * soma_x2 - soma_x * soma_x;
-                if (denominador != 0.0f) {
-                    inclinacao = (n * soma_xy - soma_x * soma_y) / denominador;
-                }
-            }
+        if (xQueueReceive(fila_dados_sensores, &dados_recebidos, portMAX_DELAY) == pdPASS) {
+            // Atualização de custo constante em todos os modelos
+            preditor_atualizar(&preditor_nivel, dados_recebidos.nivel_agua_pct);
+
+            // Previsão do modelo mais o impacto da chuva, limitada entre 0% e 100%
+            dados_enviar.nivel_agua_previsto = preditor_prever(&preditor_nivel, PREVISAO_HORIZONTE,
+                                                               dados_recebidos.volume_chuva_mmh);
+            xQueueSend(fila_dados_exibicao, &dados_enviar, pdMS_TO_TICKS(10));
+        }
+    }
+}
 
-            // Calcula previsão considerando tendência e impacto da chuva
-            float intervalos_futuros = 10.0f;
-            float nivel_previsto = dados_recebidos.nivel_agua_percent + (inclinacao * intervalos_futuros);
-            nivel_previsto += fator_chuva * dados_recebidos.volume_chuva_mmh;
+// --- TELAS DO DISPLAY ---
 
-            // Limita a previsão entre 0% e 100%
-            if (nivel_previsto < 0.0f) nivel_previsto = 0.0f;
-            else if (nivel_previsto > 100.0f) nivel_previsto = 100.0f;
+// Camada de fundo da tela atual: tudo o que não muda entre quadros
+static uint8_t fundo_tela[SSD1306_WIDTH * SSD1306_HEIGHT / 8];
 
-            dados_enviar.nivel_agua_previsto = nivel_previsto;
-            xQueueSend(fila_dados_exibicao, &dados_enviar, pdMS_TO_TICKS(10));
+// Tempos de renderização por tela, em microssegundos
+static uint32_t tempo_fundo_us[TELAS_QUANTIDADE];   // Montagem do fundo (feita só ao trocar de tela)
+static uint32_t tempo_quadro_us[TELAS_QUANTIDADE];  // Cópia do fundo + valores, média móvel por quadro
+static uint32_t idade_max_us[TELAS_QUANTIDADE];     // Maior atraso entre a medição e o desenho do quadro
+// Os três valem desde a última entrada na tela; só a tarefa de exibição escreve
+
+// Linhas "tela;" do relatório de saúde (tarefa de timers)
+static void imprimir_telas(void) {
+    printf("tela;indice;fundo_us;quadro_us;idade_max_us\n");
+    for (uint8_t i = 0; i < TELAS_QUANTIDADE; ++i) {
+        printf("tela;%u;%lu;%lu;%lu\n", i, (unsigned long)tempo_fundo_us[i],
+               (unsigned long)tempo_quadro_us[i], (unsigned long)idade_max_us[i]);
+    }
+}
+
+// Desenha a parte fixa da tela e a guarda em fundo_tela
+static void montar_fundo_tela(uint8_t tela) {
+    telas_montar_fundo(&display, tela);
+    ssd1306_save_layer(&display, fundo_tela);
+}
+
+// Desenha os valores ao vivo da tela sobre o fundo já copiado
+static void desenhar_valores_tela(uint8_t tela, const dados_sensores_t *dados, bool estado_alerta) {
+    dados_previsao_t dados_previsao;
+    dados_grafico_t grafico;
+    telas_valores_t valores = {
+        .chuva_mmh = dados->volume_chuva_mmh,
+        .chuva_pct = dados->volume_chuva_pct,
+        .nivel_pct = dados->nivel_agua_pct,
+        .alerta = estado_alerta,
+        .grafico = &grafico,
+    };
+
+    if (tela == 1 && xQueueReceive(fila_dados_exibicao, &dados_previsao, 0) == pdPASS) {
+        valores.previsao_valida = true;
+        valores.nivel_previsto = dados_previsao.nivel_agua_previsto;
+    }
+    if (tela >= 2) canal_ler(&canal_grafico, &grafico, NULL);
+    telas_desenhar_valores(&display, tela, &valores);
+}
+
+#if MODO_BAIXO_CONSUMO
+// Ajusta contraste e energia do painel conforme o alerta e o tempo sem toque no botão
+// Retorna false com o painel desligado: não há quadro a desenhar
+// Os comandos esperam o fim do flush em andamento; com o DMA ocupado a troca fica
+// para a próxima volta da tarefa, que o NOTIF_FLUSH do fim do envio garante
+static bool painel_ajustar(bool alerta, uint32_t inativo_ms) {
+    static estado_painel_t estado = PAINEL_NORMAL;
+    estado_painel_t novo = PAINEL_NORMAL;
+    if (!alerta) {
+        if (inativo_ms >= TEMPO_APAGAR_MS) novo = PAINEL_APAGADO;
+        else if (inativo_ms >= TEMPO_ESCURECER_MS) novo = PAINEL_ESCURECIDO;
+    }
+    if (novo != estado && !ssd1306_flush_busy(&display)) {
+        if (estado == PAINEL_APAGADO) ssd1306_set_power(&display, true); // GDDRAM preservada
+        if (novo == PAINEL_APAGADO) {
+            ssd1306_set_power(&display, false);
+        } else {
+            ssd1306_set_contrast(&display, novo == PAINEL_ESCURECIDO ? CONTRASTE_REDUZIDO : CONTRASTE_NORMAL);
         }
+        estado = novo;
     }
+    return estado != PAINEL_APAGADO;
 }
+#else
+// Sem o modo de baixo consumo o painel fica sempre ligado
+static bool painel_ajustar(bool alerta, uint32_t inativo_ms) {
+    (void)alerta;
+    (void)inativo_ms;
+    return true;
+}
+#endif
 
 // Tarefa que exibe informações no display OLED
 void tarefa_exibicao(void *pvParameters) {
     dados_sensores_t dados_sensores;
-    dados_previsao_t dados_previsao;
     bool estado_alerta_atual = false;
-    char buffer[32];
     uint8_t tela_atual = 0;
-
-    // Configura o botão para alternar telas
+    bool fundo_valido = false;
+    bool flush_pendente = false;
+    uint32_t sequencia = 0, carimbo_us = 0;
+    bool painel_ligado = true;
+    uint32_t ultima_interacao_ms = 0;   // Último toque aceito no botão
+    uint32_t mudanca_vista_us = 0;      // Última mudança das saídas já desenhada
+    uint32_t mudanca_quadro_us = 0;     // Mudança desenhada no quadro ainda não enviado
+
+    // Leituras novas, fim de flush e botão chegam como bits de notificação desta tarefa
+    tarefa_exibicao_handle = xTaskGetCurrentTaskHandle();
+    canal_inscrever(&canal_sensores, tarefa_exibicao_handle, NOTIF_AMOSTRA);
+    ssd1306_set_flush_callback(&display, display_flush_concluido, tarefa_exibicao_handle);
+
+    // Configura o botão para alternar telas (borda de descida por interrupção)
     gpio_init(BUTTON_A_PIN);
     gpio_set_dir(BUTTON_A_PIN, GPIO_IN);
     gpio_pull_up(BUTTON_A_PIN);
-    bool estado_botao_anterior = gpio_get(BUTTON_A_PIN);
+    gpio_set_irq_enabled_with_callback(BUTTON_A_PIN, GPIO_IRQ_EDGE_FALL, true, botao_pressionado);
     uint32_t tempo_ultimo_pressionamento = 0;
     const uint32_t delay_debounce_ms = 200;
 
     while (true) {
-        // Detecta pressionamento do botão com debounce
-        bool estado_botao_atual = gpio_get(BUTTON_A_PIN);
-        uint32_t tempo_atual = to_ms_since_boot(get_absolute_time());
-        if (estado_botao_anterior && !estado_botao_atual) {
+        uint32_t eventos = 0;
+        xTaskNotifyWait(0, UINT32_MAX, &eventos, portMAX_DELAY);
+
+        // Reenvia o quadro recusado assim que o DMA sinalizar o fim do flush anterior
+        if ((eventos & NOTIF_FLUSH) && flush_pendente) {
+            flush_pendente = !enviar_quadro(&mudanca_quadro_us);
+        }
+
+        // Debounce: bordas a menos de 200ms da anterior são repiques
+        if (eventos & NOTIF_BOTAO) {
+            uint32_t tempo_atual = to_ms_since_boot(get_absolute_time());
             if ((tempo_atual - tempo_ultimo_pressionamento) > delay_debounce_ms) {
-                tela_atual = (tela_atual + 1) % 4;
+                // Com o painel desligado, o toque só o religa
+                if (painel_ligado) {
+                    tela_atual = (tela_atual + 1) % TELAS_QUANTIDADE;
+                    fundo_valido = false; // Fundo da nova tela é montado no próximo quadro
+                }
                 tempo_ultimo_pressionamento = tempo_atual;
-                ssd1306_fill(&display, false); // Limpa o display
+                ultima_interacao_ms = tempo_atual;
             }
         }
-        estado_botao_anterior = estado_botao_atual;
 
         // Verifica o estado de alerta
         if (fila_estado_alerta != NULL) {
             xQueuePeek(fila_estado_alerta, &estado_alerta_atual, 0);
         }
 
-        // Exibe dados no display conforme a tela selecionada
-        if (xQueuePeek(fila_dados_sensores, &dados_sensores, pdMS_TO_TICKS(50)) == pdPASS) {
-            ssd1306_fill(&display, false);
-            if (tela_atual == 0) {
-                // Tela 1: Informações básicas
-                snprintf(buffer, sizeof(buffer), "QntChuva:%.2fmm", dados_sensores.volume_chuva_mmh);
-                ssd1306_draw_string(&display, buffer, 0, 0, false);
-                snprintf(buffer, sizeof(buffer), "Chuva: %.1f%%", dados_sensores.volume_chuva_percent);
-                ssd1306_draw_string(&display, buffer, 0, 13, false);
-                snprintf(buffer, sizeof(buffer), "Nivel: %.1f%%", dados_sensores.nivel_agua_percent);
-                ssd1306_draw_string(&display, buffer, 0, 26, false);
-                snprintf(buffer, sizeof(buffer), "Status: %s", estado_alerta_atual ? "ALERTA!" : "Normal");
-                ssd1306_draw_string(&display, buffer, 0, 39, false);
-                const char* cor_display;
-                if (dados_sensores.nivel_agua_percent > 95.0f) cor_display = "Cor: V. Pisc.";
-                else if (dados_sensores.nivel_agua_percent < 70.0f && dados_sensores.volume_chuva_percent > 80.0f) cor_display = "Cor: Amarelo";
-                else if (dados_sensores.nivel_agua_percent >= 70.0f && dados_sensores.nivel_agua_percent < 95.0f && dados_sensores.volume_chuva_percent > 80.0f) cor_display = "Cor: Vermelho";
-                else if (dados_sensores.nivel_agua_percent < 70.0f && dados_sensores.volume_chuva_percent <= 80.0f) cor_display = "Cor: Verde";
-                else cor_display = "Cor: Apagado";
-                ssd1306_draw_string(&display, cor_display, 0, 52, false);
-            } else if (tela_atual == 1) {
-                // Tela 2: Barras de chuva e nível
-                ssd1306_draw_string(&display, "Barra Chuva:", 0, 0, false);
-                uint8_t bar_y_chuva = 10, bar_width = SSD1306_WIDTH - 20, bar_height = 8;
-                ssd1306_rect(&display, bar_y_chuva, 0, bar_width, bar_height, true, false);
-                uint8_t chuva_fill = (uint8_t)(dados_sensores.volume_chuva_percent * (bar_width - 2) / 100.0f);
-                if (chuva_fill > 0) ssd1306_rect(&display, bar_y_chuva + 1, 1, chuva_fill, bar_height - 2, true, true);
-                ssd1306_draw_string(&display, "Barra Nivel:", 0, 25, false);
-                uint8_t bar_y_nivel = 35;
-                ssd1306_rect(&display, bar_y_nivel, 0, bar_width, bar_height, true, false);
-                uint8_t nivel_fill = (uint8_t)(dados_sensores.nivel_agua_percent * (bar_width - 2) / 100.0f);
-                if (nivel_fill > 0) ssd1306_rect(&display, bar_y_nivel + 1, 1, nivel_fill, bar_height - 2, true, true);
-                if (xQueueReceive(fila_dados_exibicao, &dados_previsao, 0) == pdPASS) {
-                    snprintf(buffer, sizeof(buffer), "Previsao:%.1f%%", dados_previsao.nivel_agua_previsto);
-                } else {
-                    snprintf(buffer, sizeof(buffer), "Previsao: N/A");
-                }
-                ssd1306_draw_string(&display, buffer, 0, 50, false);
-            } else if (tela_atual == 2) {
-                // Tela 3: Gráfico de chuva
-                const uint8_t grafico_x = 15, grafico_y = 54, altura_grafico = 45, largura_grafico = 100;
-                const char* titulo = "Chuva %";
-                uint8_t titulo_width = strlen(titulo) * 5;
-                uint8_t titulo_x_pos = (SSD1306_WIDTH - titulo_width) / 2;
-                ssd1306_draw_string(&display, titulo, titulo_x_pos, 5, true);
-                ssd1306_line(&display, grafico_x, grafico_y, grafico_x + largura_grafico, grafico_y, true);
-                ssd1306_line(&display, grafico_x, grafico_y, grafico_x, grafico_y - altura_grafico, true);
-                int n = (contagem_grafico < TAMANHO_GRAFICO) ? contagem_grafico : TAMANHO_GRAFICO;
-                for (int i = 0; i < n - 1; i++) {
-                    int idx_atual = (indice_grafico - n + i + TAMANHO_GRAFICO) % TAMANHO_GRAFICO;
-                    int idx_proximo = (indice_grafico - n + i + 1 + TAMANHO_GRAFICO) % TAMANHO_GRAFICO;
-                    float chuva_atual = dados_grafico_chuva[idx_atual], chuva_proxima = dados_grafico_chuva[idx_proximo];
-                    uint8_t y_atual = grafico_y - (uint8_t)(chuva_atual * altura_grafico / 100.0f);
-                    uint8_t y_proximo = grafico_y - (uint8_t)(chuva_proxima * altura_grafico / 100.0f);
-                    uint8_t x_atual = grafico_x + (i * largura_grafico / (TAMANHO_GRAFICO - 1));
-                    uint8_t x_proximo = grafico_x + ((i + 1) * largura_grafico / (TAMANHO_GRAFICO - 1));
-                    ssd1306_line(&display, x_atual, y_atual, x_proximo, y_proximo, true);
-                }
-                for (int i = 0; i <= 5; i++) {
-                    uint8_t y_mark = grafico_y - (i * altura_grafico / 5);
-                    ssd1306_line(&display, grafico_x - 3, y_mark, grafico_x, y_mark, true);
-                    if (i % 2 == 0) { snprintf(buffer, sizeof(buffer), "%d", i * 20); ssd1306_draw_string(&display, buffer, 0, y_mark - 3, true); }
-                }
-                for (int i = 0; i <= 4; i++) {
-                    uint8_t x_mark = grafico_x + (i * largura_grafico / 4);
-                    ssd1306_line(&display, x_mark, grafico_y, x_mark, grafico_y + 2, true);
-                    snprintf(buffer, sizeof(buffer), "%d", i * 5); ssd1306_draw_string(&display, buffer, x_mark - 8, grafico_y + 2, true);
-                }
-            } else if (tela_atual == 3) {
-                // Tela 4: Gráfico de nível
-                const uint8_t grafico_x = 15, grafico_y = 54, altura_grafico = 45, largura_grafico = 100;
-                const char* titulo = "Nivel %";
-                uint8_t titulo_width = strlen(titulo) * 5;
-                uint8_t titulo_x_pos = (SSD1306_WIDTH - titulo_width) / 2;
-                ssd1306_draw_string(&display, titulo, titulo_x_pos, 5, true);
-                ssd1306_line(&display, grafico_x, grafico_y, grafico_x + largura_grafico, grafico_y, true);
-                ssd1306_line(&display, grafico_x, grafico_y, grafico_x, grafico_y - altura_grafico, true);
-                int n = (contagem_grafico < TAMANHO_GRAFICO) ? contagem_grafico : TAMANHO_GRAFICO;
-                for (int i = 0; i < n - 1; i++) {
-                    int idx_atual = (indice_grafico - n + i + TAMANHO_GRAFICO) % TAMANHO_GRAFICO;
-                    int idx_proximo = (indice_grafico - n + i + 1 + TAMANHO_GRAFICO) % TAMANHO_GRAFICO;
-                    float nivel_atual = dados_grafico_nivel[idx_atual], nivel_proximo = dados_grafico_nivel[idx_proximo];
-                    uint8_t y_atual = grafico_y - (uint8_t)(nivel_atual * altura_grafico / 100.0f);
-                    uint8_t y_proximo = grafico_y - (uint8_t)(nivel_proximo * altura_grafico / 100.0f);
-                    uint8_t x_atual = grafico_x + (i * largura_grafico / (TAMANHO_GRAFICO - 1));
-                    uint8_t x_proximo = grafico_x + ((i + 1) * largura_grafico / (TAMANHO_GRAFICO - 1));
-                    ssd1306_line(&display, x_atual, y_atual, x_proximo, y_proximo, true);
-                }
-                for (int i = 0; i <= 5; i++) {
-                    uint8_t y_mark = grafico_y - (i * altura_grafico / 5);
-                    ssd1306_line(&display, grafico_x - 3, y_mark, grafico_x, y_mark, true);
-                    if (i % 2 == 0) { snprintf(buffer, sizeof(buffer), "%d", i * 20); ssd1306_draw_string(&display, buffer, 0, y_mark - 3, true); }
-                }
-                for (int i = 0; i <= 4; i++) {
-                    uint8_t x_mark = grafico_x + (i * largura_grafico / 4);
-                    ssd1306_line(&display, x_mark, grafico_y, x_mark, grafico_y + 2, true);
-                    snprintf(buffer, sizeof(buffer), "%d", i * 5); ssd1306_draw_string(&display, buffer, x_mark - 8, grafico_y + 2, true);
-                }
+        // Painel desligado: nada é desenhado nem enviado pelo I2C
+        painel_ligado = painel_ajustar(estado_alerta_atual,
+                                       to_ms_since_boot(get_absolute_time()) - ultima_interacao_ms);
+        if (!painel_ligado) continue;
+
+        // Redesenha só quando chega uma leitura nova ou quando a tela muda
+        if (!(eventos & NOTIF_AMOSTRA) && fundo_valido) continue;
+
+        uint32_t nova = canal_ler(&canal_sensores, &dados_sensores, &carimbo_us);
+        if (nova != 0) {
+            uint32_t inicio_us = time_us_32();
+            if (!fundo_valido) idade_max_us[tela_atual] = 0;
+            if (nova != sequencia && inicio_us - carimbo_us > idade_max_us[tela_atual]) {
+                idade_max_us[tela_atual] = inicio_us - carimbo_us;
+            }
+            sequencia = nova;
+            if (!fundo_valido) {
+                montar_fundo_tela(tela_atual);
+                tempo_fundo_us[tela_atual] = time_us_32() - inicio_us;
+                tempo_quadro_us[tela_atual] = 0;
+                fundo_valido = true;
+                inicio_us = time_us_32();
             }
-            ssd1306_send_data(&display); // Atualiza o display
+            ssd1306_load_layer(&display, fundo_tela);
+            desenhar_valores_tela(tela_atual, &dados_sensores, estado_alerta_atual);
+            if (dados_sensores.mudanca_us != mudanca_vista_us) {
+                mudanca_quadro_us = mudanca_vista_us = dados_sensores.mudanca_us;
+            }
+            uint32_t duracao_us = time_us_32() - inicio_us;
+            tempo_quadro_us[tela_atual] = tempo_quadro_us[tela_atual]
+                ? (tempo_quadro_us[tela_atual] * 7 + duracao_us) / 8 : duracao_us;
+
+            // Se o barramento estiver ocupado, o quadro fica pendente até NOTIF_FLUSH
+            flush_pendente = !enviar_quadro(&mudanca_quadro_us);
         }
     }
 }
 
 // Tarefa que controla a matriz de LEDs
+// Só escolhe a sequência; os quadros e seus tempos ficam com o alarme de animacao.c
 void tarefa_matriz_led(void *pvParameters) {
     dados_sensores_t dados;
     bool estado_alerta_recebido = false;
-    const uint32_t cor_vermelho_matriz = COR_VERMELHO;
-    const uint32_t cor_azul_matriz = COR_AZUL;
-    const uint32_t cor_amarelo_matriz = COR_AMARELO;
-    uint8_t estado_exibicao = 0;
-    uint32_t ultimo_tempo_alternancia = 0;
-    static bool primeira_entrada_chuva_alta_apos_sem_chuva = true;
+
+    canal_inscrever(&canal_sensores, xTaskGetCurrentTaskHandle(), NOTIF_AMOSTRA);
 
     while (true) {
+        // Acorda só a cada leitura nova
+        xTaskNotifyWait(0, UINT32_MAX, NULL, portMAX_DELAY);
+
         // Verifica o estado de alerta e os dados dos sensores
         if (fila_estado_alerta != NULL) {
             xQueuePeek(fila_estado_alerta, &estado_alerta_recebido, 0);
         }
-        if (xQueuePeek(fila_dados_sensores, &dados, pdMS_TO_TICKS(100)) == pdPASS) {
-            bool chuva_alta = (dados.volume_chuva_percent > 80.0f);
-            uint32_t tempo_atual = to_ms_since_boot(get_absolute_time());
-            if (estado_alerta_recebido) {
-                if (chuva_alta) {
-                    // Alterna exibições a cada 4 segundos
-                    if (primeira_entrada_chuva_alta_apos_sem_chuva) {
-                        estado_exibicao = 0;
-                        ultimo_tempo_alternancia = tempo_atual;
-                        primeira_entrada_chuva_alta_apos_sem_chuva = false;
-                    } else if ((tempo_atual - ultimo_tempo_alternancia) >= 4000) {
-                        estado_exibicao = (estado_exibicao + 1) % 3;
-                        ultimo_tempo_alternancia = tempo_atual;
-                    }
-                    if (estado_exibicao == 0) matriz_draw_rain_animation(cor_azul_matriz);
-                    else if (estado_exibicao == 1) matriz_draw_pattern(PAD_EXC, cor_amarelo_matriz);
-                    else matriz_draw_pattern(PAD_X, cor_vermelho_matriz);
-                } else {
-                    matriz_draw_pattern(PAD_X, cor_vermelho_matriz);
-                    primeira_entrada_chuva_alta_apos_sem_chuva = true;
-                    estado_exibicao = 0;
-                }
-            } else {
-                matriz_clear(); // Limpa a matriz se não houver alerta
-                primeira_entrada_chuva_alta_apos_sem_chuva = true;
-                estado_exibicao = 0;
-            }
+        if (canal_ler(&canal_sensores, &dados, NULL) != 0) {
+            bool chuva_alta = (dados.volume_chuva_pct > PCT_X100(80));
+            const animacao_t *sequencia = !estado_alerta_recebido ? &ANIM_APAGADA
+                                        : chuva_alta ? &ANIM_ALERTA_CHUVA : &ANIM_ALERTA;
+
+            // A mesma sequência segue de onde está; uma nova começa em ~1 ms e
+            // o alarme registra a latência quando o primeiro quadro dela é enviado
+            animacao_tocar(sequencia, dados.mudanca_us);
         }
-        vTaskDelay(pdMS_TO_TICKS(100));
     }
 }
 
 // Tarefa que controla o buzzer com base nas condições
+// Só escolhe o padrão; os tons e as pausas ficam com o alarme de sinais.c
 void tarefa_buzzer(void *pvParameters) {
     dados_sensores_t dados_atuais;
+    uint32_t mudanca_vista_us = 0;
+
+    canal_inscrever(&canal_sensores, xTaskGetCurrentTaskHandle(), NOTIF_AMOSTRA);
 
     while (true) {
-        if (xQueuePeek(fila_dados_sensores, &dados_atuais, pdMS_TO_TICKS(50)) == pdPASS) {
-            float nivel = dados_atuais.nivel_agua_percent;
-            float chuva = dados_atuais.volume_chuva_percent;
-
-            if (nivel > 70.0f && chuva > 80.0f) {
-                // Alerta prioritário: nível alto e chuva intensa
-                ligar_buzzer(1000);
-                vTaskDelay(pdMS_TO_TICKS(1000));
-                desligar_buzzer();
-                vTaskDelay(pdMS_TO_TICKS(500));
-            } else if (chuva > 80.0f) {
-                // Alerta de chuva intensa: dois beeps curtos
-                ligar_buzzer(1000);
-                vTaskDelay(pdMS_TO_TICKS(150));
-                desligar_buzzer();
-                vTaskDelay(pdMS_TO_TICKS(150));
-                ligar_buzzer(1000);
-                vTaskDelay(pdMS_TO_TICKS(150));
-                desligar_buzzer();
-                vTaskDelay(pdMS_TO_TICKS(150));
-            } else if (nivel > 70.0f) {
-                // Alerta de nível alto: beep intermitente
-                ligar_buzzer(1000);
-                vTaskDelay(pdMS_TO_TICKS(200));
-                desligar_buzzer();
-                vTaskDelay(pdMS_TO_TICKS(200));
+        if (canal_ler(&canal_sensores, &dados_atuais, NULL) != 0) {
+            uint16_t nivel = dados_atuais.nivel_agua_pct;
+            uint16_t chuva = dados_atuais.volume_chuva_pct;
+            const sinal_padrao_t *padrao;
+
+            if (nivel > PCT_X100(70) && chuva > PCT_X100(80)) {
+                padrao = &SINAL_TOM_PRIORITARIO;    // Alerta prioritário: nível alto e chuva intensa
+            } else if (chuva > PCT_X100(80)) {
+                padrao = &SINAL_TOM_CHUVA;          // Alerta de chuva intensa: dois beeps curtos
+            } else if (nivel > PCT_X100(70)) {
+                padrao = &SINAL_TOM_NIVEL;          // Alerta de nível alto: beep intermitente
             } else {
-                desligar_buzzer();
-                vTaskDelay(pdMS_TO_TICKS(50));
+                padrao = &SINAL_DESLIGADO;          // Sem alerta: silêncio
             }
-        } else {
-            desligar_buzzer();
-            vTaskDelay(pdMS_TO_TICKS(50));
+            // O mesmo padrão segue de onde está; um novo começa na hora
+            sinais_tocar(SINAL_BUZZER, padrao);
+            registrar_reacao(&latencia_buzzer, &mudanca_vista_us, dados_atuais.mudanca_us);
         }
+        xTaskNotifyWait(0, UINT32_MAX, NULL, portMAX_DELAY);
     }
 }
 
@@ -475,21 +749,56 @@ int main() {
     ssd1306_send_data(&display);
 
     inicializar_matriz_led(); // Inicializa a matriz de LEDs
+    animacao_iniciar(matriz_quadro_enviado);
+    sinais_iniciar(BUZZER_PIN, LED_PIN, LED_VERDE_PIN); // Buzzer e LEDs indicadores desligados
 
     // Cria as filas de comunicação
-    fila_dados_sensores = xQueueCreate(10, sizeof(dados_sensores_t));
-    fila_dados_exibicao = xQueueCreate(5, sizeof(dados_previsao_t));
-    fila_estado_alerta = xQueueCreate(1, sizeof(bool));
+    CRIAR_FILA(fila_dados_sensores, 10, dados_sensores_t);
+    CRIAR_FILA(fila_dados_exibicao, 5, dados_previsao_t);
+    CRIAR_FILA(fila_estado_alerta, 1, bool);
     if (fila_dados_sensores == NULL || fila_dados_exibicao == NULL || fila_estado_alerta == NULL) {
         while (1); // Trava se as filas não forem criadas
     }
+    saude_registrar_fila(fila_dados_sensores, "sensores");
+    saude_registrar_fila(fila_dados_exibicao, "exibicao");
+    saude_registrar_fila(fila_estado_alerta, "alerta");
+    latencia_iniciar(&latencia_led, "led");
+    latencia_iniciar(&latencia_buzzer, "buzzer");
+    latencia_iniciar(&latencia_matriz, "matriz");
+    latencia_iniciar(&latencia_oled, "oled");
+    saude_registrar_relatorio(imprimir_telas);
+    saude_iniciar_comandos(); // 's' no terminal imprime o relatório de saúde, 'l' as latências
+
+    canal_iniciar(&canal_sensores, &ultima_leitura_sensores, sizeof(dados_sensores_t));
+    canal_iniciar(&canal_grafico, &grafico_publicado, sizeof(dados_grafico_t));
+
+    // Relatório periódico de despertares e tempo ocioso
+    TimerHandle_t timer_atividade;
+    CRIAR_TIMER(timer_atividade, "Atividade", pdMS_TO_TICKS(RELATORIO_ATIVIDADE_MS), pdTRUE, relatorio_atividade);
+    if (timer_atividade == NULL || xTimerStart(timer_atividade, 0) != pdPASS) {
+        while (1); // Trava se o timer não for criado
+    }
 
     // Cria as tarefas do FreeRTOS
-    xTaskCreate(tarefa_medicao, "Leitura", 512, NULL, 2, NULL);
-    xTaskCreate(tarefa_previsao, "Previsao", configMINIMAL_STACK_SIZE + 256, NULL, 1, NULL);
-    xTaskCreate(tarefa_exibicao, "Exibicao", configMINIMAL_STACK_SIZE + 512, NULL, 1, NULL);
-    xTaskCreate(tarefa_matriz_led, "MatrizLED", configMINIMAL_STACK_SIZE + 768, NULL, 1, NULL);
-    xTaskCreate(tarefa_buzzer, "Buzzer", configMINIMAL_STACK_SIZE + 256, NULL, 1, NULL);
+    TaskHandle_t tarefas[5];
+    CRIAR_TAREFA(tarefa_medicao, "Leitura", PILHA(LEITURA), 2, &tarefas[0]);
+    CRIAR_TAREFA(tarefa_previsao, "Previsao", PILHA(PREVISAO), 1, &tarefas[1]);
+    CRIAR_TAREFA(tarefa_buzzer, "Buzzer", PILHA(BUZZER), 1, &tarefas[2]);
+    CRIAR_TAREFA(tarefa_exibicao, "Exibicao", PILHA(EXIBICAO), 1, &tarefas[3]);
+    CRIAR_TAREFA(tarefa_matriz_led, "MatrizLED", PILHA(MATRIZLED), 1, &tarefas[4]);
+
+#if MODO_PERFIL_PILHAS
+    perfil_pilhas_iniciar(TELAS_QUANTIDADE);
+    for (int i = 0; i < 5; ++i) perfil_pilhas_registrar(tarefas[i], PERFIL_PILHA_PALAVRAS);
+#endif
+
+#if MODO_SMP
+    // Núcleo 0: aquisição, previsão e alertas (LEDs na própria medição, buzzer)
+    // Núcleo 1: renderização do OLED e matriz WS2812
+    for (int i = 0; i < 5; ++i) {
+        vTaskCoreAffinitySet(tarefas[i], i < 3 ? NUCLEO_AQUISICAO : NUCLEO_INTERFACE);
+    }
+#endif
 
     vTaskStartScheduler(); // Inicia o escalonador do FreeRTOS
 
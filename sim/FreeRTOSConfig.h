@@ -0,0 +1,29 @@
+#ifndef SIM_FREERTOS_CONFIG_H
+#define SIM_FREERTOS_CONFIG_H
+
+/* Configuração da simulação: a mesma do alvo (mesmos ganchos de atividade,
+ * saúde e rastro), com os ajustes que o port POSIX exige. */
+#include "../lib/FreeRTOSConfig.h"
+
+#if MODO_SMP || MODO_BAIXO_CONSUMO
+#error "A simulação usa o port POSIX de núcleo único e sem tickless"
+#endif
+
+/* As pilhas das tarefas viram pilhas de pthreads (mínimo de 16 KB no glibc) */
+#undef configMINIMAL_STACK_SIZE
+#define configMINIMAL_STACK_SIZE                ( configSTACK_DEPTH_TYPE ) 4096
+#undef configTIMER_TASK_STACK_DEPTH
+#define configTIMER_TASK_STACK_DEPTH            ( configMINIMAL_STACK_SIZE * 2 )
+#undef configTOTAL_HEAP_SIZE
+#define configTOTAL_HEAP_SIZE                   ( 1024 * 1024 )
+
+/* Só o port.c é compilado com SIM_TICK_DO_PORT: o timer do port dispara
+ * SIM_ACELERACAO vezes por milissegundo real, e o resto do kernel continua
+ * vendo ticks de 1 ms */
+#ifdef SIM_TICK_DO_PORT
+#include "sim.h"
+#undef configTICK_RATE_HZ
+#define configTICK_RATE_HZ                      ( ( TickType_t ) ( 1000 * SIM_ACELERACAO ) )
+#endif
+
+#endif /* SIM_FREERTOS_CONFIG_H */
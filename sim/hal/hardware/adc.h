@@ -0,0 +1,11 @@
+#ifndef SIM_HARDWARE_ADC_H
+#define SIM_HARDWARE_ADC_H
+#include "pico/stdlib.h"
+
+// Só a leitura bloqueante: a simulação usa AQUISICAO_DMA 0
+void adc_init(void);
+void adc_gpio_init(uint gpio);
+void adc_select_input(uint input);
+uint16_t adc_read(void);
+
+#endif
@@ -0,0 +1,8 @@
+#ifndef SIM_HARDWARE_CLOCKS_H
+#define SIM_HARDWARE_CLOCKS_H
+#include "pico/stdlib.h"
+
+enum clock_index { clk_gpout0 = 0, clk_ref = 4, clk_sys = 5, clk_peri = 6, clk_usb = 7, clk_adc = 8 };
+uint32_t clock_get_hz(enum clock_index clk_index);
+
+#endif
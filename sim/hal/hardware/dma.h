@@ -0,0 +1,32 @@
+#ifndef SIM_HARDWARE_DMA_H
+#define SIM_HARDWARE_DMA_H
+#include "pico/stdlib.h"
+
+#define SIM_DMA_CANAIS 12
+
+typedef struct {
+    volatile uint32_t ints0, ints1;
+} dma_hw_t;
+extern dma_hw_t *dma_hw;
+
+typedef struct {
+    uint32_t ctrl;
+} dma_channel_config;
+
+enum dma_channel_transfer_size { DMA_SIZE_8 = 0, DMA_SIZE_16 = 1, DMA_SIZE_32 = 2 };
+
+// Só os caminhos memória -> I2C (flush do SSD1306) e memória -> PIO (quadro WS2812)
+// são simulados; o destino de cada canal é o write_addr de dma_channel_configure
+int dma_claim_unused_channel(bool required);
+dma_channel_config dma_channel_get_default_config(uint channel);
+static inline void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size) { c->ctrl = size; }
+static inline void channel_config_set_read_increment(dma_channel_config *c, bool incr) { (void)c; (void)incr; }
+static inline void channel_config_set_write_increment(dma_channel_config *c, bool incr) { (void)c; (void)incr; }
+static inline void channel_config_set_dreq(dma_channel_config *c, uint dreq) { (void)c; (void)dreq; }
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger);
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count);
+void dma_channel_set_irq0_enabled(uint channel, bool enabled);
+void dma_channel_set_irq1_enabled(uint channel, bool enabled);
+
+#endif
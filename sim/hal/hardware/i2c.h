@@ -0,0 +1,27 @@
+#ifndef SIM_HARDWARE_I2C_H
+#define SIM_HARDWARE_I2C_H
+#include "pico/stdlib.h"
+
+typedef struct {
+    volatile uint32_t enable, tar, data_cmd, status, clr_tx_abrt;
+} i2c_hw_t;
+
+typedef struct i2c_inst {
+    i2c_hw_t hw;
+    uint baudrate;
+} i2c_inst_t;
+
+extern i2c_inst_t sim_i2c0_inst, sim_i2c1_inst;
+#define i2c0 (&sim_i2c0_inst)
+#define i2c1 (&sim_i2c1_inst)
+
+#define I2C_IC_DATA_CMD_STOP_BITS 0x00000200u
+#define I2C_IC_STATUS_TFE_BITS 0x00000004u
+#define I2C_IC_STATUS_MST_ACTIVITY_BITS 0x00000020u
+
+uint i2c_init(i2c_inst_t *i2c, uint baudrate);
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop);
+static inline i2c_hw_t *i2c_get_hw(i2c_inst_t *i2c) { return &i2c->hw; }
+static inline uint i2c_get_dreq(i2c_inst_t *i2c, bool is_tx) { (void)i2c; (void)is_tx; return 0; }
+
+#endif
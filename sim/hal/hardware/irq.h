@@ -0,0 +1,14 @@
+#ifndef SIM_HARDWARE_IRQ_H
+#define SIM_HARDWARE_IRQ_H
+#include "pico/stdlib.h"
+
+typedef void (*irq_handler_t)(void);
+enum { DMA_IRQ_0 = 11, DMA_IRQ_1 = 12, ADC_IRQ_FIFO = 22 };
+#define PICO_SHARED_IRQ_HANDLER_DEFAULT_ORDER_PRIORITY 0x80
+
+// Os handlers rodam na tarefa "SimIRQ", de prioridade máxima (ver sim_hal.c)
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority);
+void irq_set_enabled(uint num, bool enabled);
+
+#endif
@@ -0,0 +1,42 @@
+#ifndef SIM_HARDWARE_PIO_H
+#define SIM_HARDWARE_PIO_H
+#include "pico/stdlib.h"
+
+// Só o FIFO de TX existe: o DMA da matriz escreve nele (ver sim_hal.c)
+typedef struct pio_hw {
+    volatile uint32_t txf[4];
+} pio_hw_t;
+typedef pio_hw_t *PIO;
+extern pio_hw_t *const sim_pio0;
+#define pio0 sim_pio0
+
+typedef struct pio_program {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+    uint8_t pio_version;
+    uint32_t used_gpio_ranges;
+} pio_program_t;
+
+typedef struct {
+    uint32_t clkdiv;
+} pio_sm_config;
+
+enum pio_fifo_join { PIO_FIFO_JOIN_NONE = 0, PIO_FIFO_JOIN_TX = 1, PIO_FIFO_JOIN_RX = 2 };
+
+// Configuração da state machine não tem efeito; só os dados do FIFO de TX importam
+static inline pio_sm_config pio_get_default_sm_config(void) { pio_sm_config c = {0}; return c; }
+static inline void sm_config_set_wrap(pio_sm_config *c, uint wrap_target, uint wrap) { (void)c; (void)wrap_target; (void)wrap; }
+static inline void sm_config_set_sideset(pio_sm_config *c, uint bit_count, bool optional, bool pindirs) { (void)c; (void)bit_count; (void)optional; (void)pindirs; }
+static inline void sm_config_set_sideset_pins(pio_sm_config *c, uint sideset_base) { (void)c; (void)sideset_base; }
+static inline void sm_config_set_out_shift(pio_sm_config *c, bool shift_right, bool autopull, uint pull_threshold) { (void)c; (void)shift_right; (void)autopull; (void)pull_threshold; }
+static inline void sm_config_set_fifo_join(pio_sm_config *c, enum pio_fifo_join join) { (void)c; (void)join; }
+static inline void sm_config_set_clkdiv(pio_sm_config *c, float div) { (void)c; (void)div; }
+static inline uint pio_add_program(PIO pio, const pio_program_t *program) { (void)pio; (void)program; return 0; }
+static inline void pio_gpio_init(PIO pio, uint pin) { (void)pio; (void)pin; }
+static inline void pio_sm_set_consecutive_pindirs(PIO pio, uint sm, uint pin_base, uint pin_count, bool is_out) { (void)pio; (void)sm; (void)pin_base; (void)pin_count; (void)is_out; }
+static inline int pio_sm_init(PIO pio, uint sm, uint initial_pc, const pio_sm_config *config) { (void)pio; (void)sm; (void)initial_pc; (void)config; return 0; }
+static inline void pio_sm_set_enabled(PIO pio, uint sm, bool enabled) { (void)pio; (void)sm; (void)enabled; }
+static inline uint pio_get_dreq(PIO pio, uint sm, bool is_tx) { (void)pio; (void)is_tx; return sm; }
+
+#endif
@@ -0,0 +1,15 @@
+#ifndef SIM_HARDWARE_SYNC_H
+#define SIM_HARDWARE_SYNC_H
+#include "pico/stdlib.h"
+
+static inline void __dmb(void) { __sync_synchronize(); }
+
+// Spin locks: com um núcleo só, a trava é uma seção crítica do FreeRTOS, que
+// também exclui a SimIRQ (uma tarefa como as outras no port POSIX)
+typedef volatile uint32_t spin_lock_t;
+int spin_lock_claim_unused(bool required);
+spin_lock_t *spin_lock_instance(uint lock_num);
+uint32_t spin_lock_blocking(spin_lock_t *lock);
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq);
+
+#endif
@@ -0,0 +1,70 @@
+#ifndef SIM_PICO_STDLIB_H
+#define SIM_PICO_STDLIB_H
+
+/* ---------- HAL simulada: núcleo do SDK ----------
+ * Subconjunto do Pico SDK usado pelo firmware, com as mesmas assinaturas.
+ * O tempo é o relógio monotônico do host multiplicado por SIM_ACELERACAO
+ * (ver sim/sim.h); GPIO, PWM, WS2812 e I2C são registrados em arquivo.
+ */
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdio.h>
+
+typedef unsigned int uint;
+typedef uint64_t absolute_time_t;
+
+#define __not_in_flash_func(f) f
+#define __time_critical_func(f) f
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+#define PICO_ERROR_TIMEOUT (-1)
+
+// Tempo
+uint64_t time_us_64(void);
+uint32_t time_us_32(void);
+absolute_time_t get_absolute_time(void);
+uint32_t to_ms_since_boot(absolute_time_t t);
+uint64_t to_us_since_boot(absolute_time_t t);
+void sleep_ms(uint32_t ms);
+void sleep_us(uint64_t us);
+static inline void tight_loop_contents(void) {}
+
+// Alarmes: as callbacks rodam na tarefa SimIRQ; o retorno segue o SDK
+// (<0 reagenda a partir do alvo anterior, >0 a partir de agora, 0 encerra)
+typedef int32_t alarm_id_t;
+typedef int64_t (*alarm_callback_t)(alarm_id_t id, void *user_data);
+alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void *user_data, bool fire_if_past);
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past);
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past);
+bool cancel_alarm(alarm_id_t alarm_id);
+
+// stdio
+bool stdio_init_all(void);
+int getchar_timeout_us(uint32_t timeout_us);
+void stdio_set_chars_available_callback(void (*fn)(void *), void *param);
+
+// GPIO
+#define GPIO_OUT 1
+#define GPIO_IN 0
+enum gpio_function {
+    GPIO_FUNC_SPI = 1, GPIO_FUNC_UART = 2, GPIO_FUNC_I2C = 3, GPIO_FUNC_PWM = 4,
+    GPIO_FUNC_SIO = 5, GPIO_FUNC_PIO0 = 6, GPIO_FUNC_PIO1 = 7, GPIO_FUNC_NULL = 0x1f
+};
+enum gpio_irq_level {
+    GPIO_IRQ_LEVEL_LOW = 0x1u, GPIO_IRQ_LEVEL_HIGH = 0x2u,
+    GPIO_IRQ_EDGE_FALL = 0x4u, GPIO_IRQ_EDGE_RISE = 0x8u
+};
+typedef void (*gpio_irq_callback_t)(uint gpio, uint32_t event_mask);
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_pull_up(uint gpio);
+void gpio_set_function(uint gpio, enum gpio_function fn);
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, gpio_irq_callback_t callback);
+
+// Multinúcleo: a simulação roda o port POSIX de núcleo único
+static inline uint get_core_num(void) { return 0; }
+
+#endif /* SIM_PICO_STDLIB_H */
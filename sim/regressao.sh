@@ -0,0 +1,40 @@
+#!/bin/sh
+# Regressão da simulação: compila sim/ (FreeRTOS-Kernel de FREERTOS_KERNEL_PATH ou,
+# sem ela, baixado na versão fixada em sim/CMakeLists.txt), roda o cenário de cheia
+# embutido e compara o resumo das saídas (tools/sim_resumo.py) com a referência.
+#
+# Uso: sim/regressao.sh              compara com sim/referencia/cenario_cheia.txt
+#      sim/regressao.sh --atualizar  grava a referência, mais saidas.csv e os PBMs
+#                                    da execução em sim/referencia/cenario_cheia/
+# BUILD_SIM escolhe o diretório de build (padrão build_sim)
+set -e
+
+RAIZ=$(cd "$(dirname "$0")/.." && pwd)
+BUILD=${BUILD_SIM:-$RAIZ/build_sim}
+REFERENCIA=$RAIZ/sim/referencia/cenario_cheia.txt
+
+cmake -S "$RAIZ/sim" -B "$BUILD"
+cmake --build "$BUILD"
+
+SAIDA=$(mktemp -d)
+trap 'rm -rf "$SAIDA"' EXIT
+# Sem SIM_SENSORES: cenário de cheia embutido (sim_hal.c)
+env -u SIM_SENSORES -u SIM_BOTAO -u SIM_COMANDOS -u SIM_CAUDA_MS \
+    SIM_SAIDA="$SAIDA" "$BUILD/RTOS_filas_sim" > "$SAIDA/terminal.txt"
+python3 "$RAIZ/tools/sim_resumo.py" "$SAIDA" > "$SAIDA/resumo.txt"
+
+if [ "$1" = "--atualizar" ]; then
+    rm -rf "$RAIZ/sim/referencia/cenario_cheia"
+    mkdir -p "$RAIZ/sim/referencia/cenario_cheia"
+    cp "$SAIDA"/saidas.csv "$SAIDA"/*.pbm "$RAIZ/sim/referencia/cenario_cheia/"
+    cp "$SAIDA/resumo.txt" "$REFERENCIA"
+    echo "referência gravada em $REFERENCIA"
+    exit 0
+fi
+
+if [ ! -f "$REFERENCIA" ]; then
+    echo "sem referência: rode sim/regressao.sh --atualizar e versione sim/referencia/" >&2
+    exit 1
+fi
+diff -u "$REFERENCIA" "$SAIDA/resumo.txt"
+echo "regressão ok"
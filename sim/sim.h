@@ -0,0 +1,48 @@
+#ifndef SIM_H
+#define SIM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/* ---------- Simulação no host ----------
+ * O firmware inteiro (main.c e bibliotecas) roda sobre o port POSIX do
+ * FreeRTOS e sobre a HAL de sim/hal, que substitui o Pico SDK:
+ *  - adc_read segue um roteiro de sensores (SIM_SENSORES)
+ *  - gpio_put, PWM e quadros WS2812 vão para <SIM_SAIDA>/saidas.csv
+ *  - o tráfego I2C do SSD1306 é decodificado em uma GDDRAM simulada, salva
+ *    como <SIM_SAIDA>/oled_<ms>.pbm a cada quadro que muda a tela
+ *  - as IRQs (fins de DMA, alarmes, botão, stdio) rodam na tarefa SimIRQ,
+ *    de prioridade máxima, com a mesma semântica FromISR do alvo
+ * O tempo simulado corre SIM_ACELERACAO vezes mais rápido que o real: o tick
+ * do port POSIX é encurtado na mesma proporção (ver sim/CMakeLists.txt).
+ *
+ * Variáveis de ambiente:
+ *  SIM_SENSORES  CSV "tempo_ms,nivel_adc,chuva_adc" (12 bits, interpolado);
+ *                sem ela, um cenário de cheia embutido
+ *  SIM_SAIDA     diretório dos registros (padrão "sim_saida")
+ *  SIM_BOTAO     instantes em ms de toques no botão A, separados por vírgula
+ *  SIM_CAUDA_MS  tempo simulado após o fim do roteiro (padrão 2000)
+ *  SIM_COMANDOS  caracteres entregues ao stdio ao fim (ex.: "sl" imprime
+ *                saúde e latências antes de encerrar)
+ */
+#ifndef SIM_ACELERACAO
+#define SIM_ACELERACAO 10
+#endif
+
+#define SIM_ENDERECO_OLED 0x3C
+#define SIM_OLED_LARGURA 128
+#define SIM_OLED_PAGINAS 8
+
+// Chamada por stdio_init_all: lê o ambiente, abre os registros e cria a SimIRQ
+void sim_iniciar(void);
+
+// Uma linha "tempo_us;saida;canal;valor" em saidas.csv
+void sim_registrar(const char *saida, uint32_t canal, const char *valor);
+
+/* ---------- SSD1306 simulado (sim_oled.c) ---------- */
+void sim_oled_transacao(const uint8_t *bytes, uint32_t n);
+void sim_oled_stream(const uint16_t *palavras, uint32_t n);    // Formato IC_DATA_CMD, STOP fecha a transação
+bool sim_oled_salvar(const char *diretorio, uint64_t tempo_us); // PBM se a GDDRAM mudou desde o último
+uint32_t sim_oled_quadros(void);
+
+#endif /* SIM_H */
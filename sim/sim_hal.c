@@ -0,0 +1,615 @@
+#define _POSIX_C_SOURCE 200809L
+#include <errno.h>
+#include <poll.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "sim.h"
+#include "pico/stdlib.h"
+#include "hardware/adc.h"
+#include "hardware/clocks.h"
+#include "hardware/dma.h"
+#include "hardware/i2c.h"
+#include "hardware/irq.h"
+#include "hardware/pio.h"
+#include "hardware/pwm.h"
+#include "hardware/sync.h"
+#include "FreeRTOS.h"
+#include "task.h"
+
+#define SIM_GPIOS 30
+#define SIM_IRQS 32
+#define SIM_HANDLERS_POR_IRQ 4
+#define SIM_TOQUES_MAX 64
+#define SIM_PIXELS_MAX 64
+#define SIM_LATCH_WS2812_US 50          // Linha parada por mais que isso fecha o quadro
+#define SIM_STDIO_PERIODO_MS 10         // Consulta ao stdin da SimIRQ
+#define SIM_ALARMES 16
+#define SIM_SPIN_LOCKS 32
+
+/* ---------- Roteiro dos sensores ---------- */
+typedef struct {
+    uint32_t tempo_ms;
+    uint16_t nivel, chuva;              // Leituras brutas de 12 bits
+} sim_ponto_t;
+
+// Cenário embutido: chuva sobe antes do rio, cheia passa de 95% e a água baixa
+static const sim_ponto_t cenario_cheia[] = {
+    {0, 400, 200}, {10000, 800, 2600}, {25000, 2400, 3600}, {40000, 3300, 3900},
+    {50000, 4000, 3000}, {65000, 3000, 1200}, {80000, 900, 300}, {90000, 500, 100},
+};
+
+static sim_ponto_t *roteiro = NULL;
+static uint32_t n_roteiro = 0;
+static uint32_t canal_adc = 0;
+static uint32_t leituras_adc = 0;
+
+/* ---------- Estado dos periféricos ---------- */
+static int8_t gpio_valor[SIM_GPIOS];
+static gpio_irq_callback_t gpio_callback = NULL;
+static uint gpio_botao = 0;
+static uint32_t toques_ms[SIM_TOQUES_MAX];
+static uint32_t n_toques = 0, proximo_toque = 0;
+
+typedef struct {
+    float divisor;
+    uint16_t wrap;
+    uint16_t nivel[2];
+    bool ligado;
+    int gpio;                           // Último pino ligado à fatia como GPIO_FUNC_PWM
+    long registrado;                    // Última frequência registrada (0 = silêncio)
+} sim_pwm_t;
+static sim_pwm_t pwm[8];
+
+static uint32_t pixels[SIM_PIXELS_MAX];
+static uint32_t n_pixels = 0;
+static uint64_t ultimo_pixel_us = 0;
+static uint32_t quadros_ws2812 = 0;
+
+i2c_inst_t sim_i2c0_inst, sim_i2c1_inst;
+static dma_hw_t dma_registradores;
+dma_hw_t *dma_hw = &dma_registradores;
+static pio_hw_t pio0_registradores;
+pio_hw_t *const sim_pio0 = &pio0_registradores;
+
+typedef struct {
+    volatile void *destino;             // IC_DATA_CMD do I2C ou FIFO de TX do PIO
+    const volatile void *origem;
+    uint32_t n;
+    uint64_t fim_us;                    // Instante simulado em que a última palavra sai na linha
+    bool ativo, irq0, irq1;
+} sim_dma_t;
+static sim_dma_t dma[SIM_DMA_CANAIS];
+static int dma_proximo_livre = 0;
+
+static irq_handler_t handlers[SIM_IRQS][SIM_HANDLERS_POR_IRQ];
+static bool irq_habilitada[SIM_IRQS];
+
+typedef struct {
+    alarm_id_t id;
+    uint64_t alvo_us;
+    alarm_callback_t callback;
+    void *dados;
+    bool ativo;
+} sim_alarme_t;
+static sim_alarme_t alarmes[SIM_ALARMES];
+static alarm_id_t ultimo_alarme = 0;
+
+static spin_lock_t spin_locks[SIM_SPIN_LOCKS];
+static uint32_t spin_locks_usados = 0;
+
+static void (*stdio_callback)(void *) = NULL;
+static void *stdio_parametro = NULL;
+static bool stdio_avisado = false;
+static bool stdin_fechado = false;
+static const char *comandos = NULL;     // SIM_COMANDOS, entregues ao fim
+
+/* ---------- Registro e encerramento ---------- */
+static const char *diretorio_saida = "sim_saida";
+static FILE *saidas = NULL;
+static TaskHandle_t tarefa_irq = NULL;
+static uint64_t fim_roteiro_us = 0;
+static struct timespec inicio_real;
+
+/* ---------- Tempo ---------- */
+static uint64_t real_us(void) {
+    struct timespec agora;
+    clock_gettime(CLOCK_MONOTONIC, &agora);
+    return (uint64_t)(agora.tv_sec - inicio_real.tv_sec) * 1000000u
+         + (uint64_t)((int64_t)agora.tv_nsec - inicio_real.tv_nsec) / 1000;
+}
+
+uint64_t time_us_64(void) {
+    if (inicio_real.tv_sec == 0) clock_gettime(CLOCK_MONOTONIC, &inicio_real);
+    return real_us() * SIM_ACELERACAO;
+}
+
+uint32_t time_us_32(void) {
+    return (uint32_t)time_us_64();
+}
+
+absolute_time_t get_absolute_time(void) {
+    return time_us_64();
+}
+
+uint32_t to_ms_since_boot(absolute_time_t t) {
+    return (uint32_t)(t / 1000);
+}
+
+uint64_t to_us_since_boot(absolute_time_t t) {
+    return t;
+}
+
+// Espera ativa em tempo simulado; o port POSIX retoma a chamada após um sinal do tick
+void sleep_us(uint64_t us) {
+    uint64_t ns = us * 1000u / SIM_ACELERACAO;
+    struct timespec pedido = { (time_t)(ns / 1000000000u), (long)(ns % 1000000000u) }, resto;
+    while (nanosleep(&pedido, &resto) != 0 && errno == EINTR) pedido = resto;
+}
+
+void sleep_ms(uint32_t ms) {
+    sleep_us((uint64_t)ms * 1000u);
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index) {
+    return clk_index == clk_adc || clk_index == clk_usb ? 48000000u : 125000000u;
+}
+
+void sim_registrar(const char *saida, uint32_t canal, const char *valor) {
+    if (saidas == NULL) return;
+    fprintf(saidas, "%llu;%s;%lu;%s\n", (unsigned long long)time_us_64(), saida, (unsigned long)canal, valor);
+}
+
+/* ---------- ADC ---------- */
+void adc_init(void) {}
+void adc_gpio_init(uint gpio) { (void)gpio; }
+
+void adc_select_input(uint input) {
+    canal_adc = input;
+}
+
+// ADC0 = chuva, ADC1 = nível, interpolados no instante simulado
+uint16_t adc_read(void) {
+    uint32_t agora_ms = to_ms_since_boot(get_absolute_time());
+    uint32_t i = 1;
+    leituras_adc++;
+    while (i < n_roteiro && roteiro[i].tempo_ms <= agora_ms) ++i;
+    if (i >= n_roteiro) {
+        const sim_ponto_t *p = &roteiro[n_roteiro - 1];
+        return canal_adc == 1 ? p->nivel : p->chuva;
+    }
+    const sim_ponto_t *a = &roteiro[i - 1], *b = &roteiro[i];
+    int32_t va = canal_adc == 1 ? a->nivel : a->chuva;
+    int32_t vb = canal_adc == 1 ? b->nivel : b->chuva;
+    int32_t dt = (int32_t)(b->tempo_ms - a->tempo_ms);
+    int32_t t = agora_ms < a->tempo_ms ? 0 : (int32_t)(agora_ms - a->tempo_ms);
+    return (uint16_t)(dt > 0 ? va + (vb - va) * t / dt : vb);
+}
+
+/* ---------- GPIO ---------- */
+void gpio_init(uint gpio) { (void)gpio; }
+void gpio_set_dir(uint gpio, bool out) { (void)gpio; (void)out; }
+void gpio_pull_up(uint gpio) { (void)gpio; }
+
+void gpio_put(uint gpio, bool value) {
+    if (gpio >= SIM_GPIOS || gpio_valor[gpio] == (int8_t)value) return;
+    gpio_valor[gpio] = (int8_t)value;
+    sim_registrar("gpio", gpio, value ? "1" : "0");
+}
+
+// Entradas ficam em repouso em 1 (pull-up); o botão só existe pelas bordas de SIM_BOTAO
+bool gpio_get(uint gpio) {
+    (void)gpio;
+    return true;
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn) {
+    if (fn == GPIO_FUNC_PWM) pwm[pwm_gpio_to_slice_num(gpio)].gpio = (int)gpio;
+    if (gpio < SIM_GPIOS) gpio_valor[gpio] = -1;    // Próximo gpio_put é registrado
+}
+
+void gpio_set_irq_enabled_with_callback(uint gpio, uint32_t events, bool enabled, gpio_irq_callback_t callback) {
+    if (!enabled || !(events & GPIO_IRQ_EDGE_FALL)) return;
+    gpio_botao = gpio;
+    gpio_callback = callback;
+}
+
+/* ---------- PWM ---------- */
+// Registra a frequência enquanto a fatia está ligada com nível > 0 e 0 caso contrário,
+// só quando ela muda
+static void registrar_pwm(uint slice_num) {
+    sim_pwm_t *p = &pwm[slice_num & 7];
+    float divisor = p->divisor > 0 ? p->divisor : 1.0f;
+    long hz = p->ligado && (p->nivel[0] || p->nivel[1])
+            ? (long)(clock_get_hz(clk_sys) / divisor / (p->wrap + 1u) + 0.5f) : 0;
+    if (hz == p->registrado) return;
+    p->registrado = hz;
+    char valor[16];
+    snprintf(valor, sizeof(valor), "%ld", hz);
+    sim_registrar("pwm", p->gpio >= 0 ? (uint32_t)p->gpio : slice_num, valor);
+}
+
+void pwm_set_clkdiv(uint slice_num, float divider) {
+    pwm[slice_num & 7].divisor = divider;
+    registrar_pwm(slice_num);
+}
+
+void pwm_set_wrap(uint slice_num, uint16_t wrap) {
+    pwm[slice_num & 7].wrap = wrap;
+    registrar_pwm(slice_num);
+}
+
+void pwm_set_chan_level(uint slice_num, uint chan, uint16_t level) {
+    pwm[slice_num & 7].nivel[chan & 1] = level;
+    registrar_pwm(slice_num);
+}
+
+void pwm_set_enabled(uint slice_num, bool enabled) {
+    pwm[slice_num & 7].ligado = enabled;
+    registrar_pwm(slice_num);
+}
+
+/* ---------- WS2812 (PIO) ---------- */
+static void fechar_quadro_ws2812(void) {
+    char valor[SIM_PIXELS_MAX * 7 + 1];
+    uint32_t n;
+    taskENTER_CRITICAL();
+    n = n_pixels;
+    for (uint32_t i = 0; i < n; ++i) {
+        uint32_t grb = pixels[i] >> 8;
+        snprintf(&valor[i * 7], 8, "%02lx%02lx%02lx ", (unsigned long)((grb >> 8) & 0xFF),
+                 (unsigned long)(grb >> 16), (unsigned long)(grb & 0xFF));   // RRGGBB
+    }
+    n_pixels = 0;
+    taskEXIT_CRITICAL();
+    if (n == 0) return;
+    valor[n * 7 - 1] = '\0';
+    quadros_ws2812++;
+    sim_registrar("ws2812", 0, valor);
+}
+
+// Cada palavra é um pixel WS2812 (GRB << 8); o quadro fecha após 50 us sem dados
+static void receber_pixels(const volatile uint32_t *palavras, uint32_t n, uint64_t agora) {
+    if (n_pixels > 0 && agora - ultimo_pixel_us > SIM_LATCH_WS2812_US) fechar_quadro_ws2812();
+    taskENTER_CRITICAL();
+    for (uint32_t i = 0; i < n && n_pixels < SIM_PIXELS_MAX; ++i) pixels[n_pixels++] = palavras[i];
+    ultimo_pixel_us = agora;
+    taskEXIT_CRITICAL();
+}
+
+/* ---------- I2C e DMA ---------- */
+uint i2c_init(i2c_inst_t *i2c, uint baudrate) {
+    i2c->baudrate = baudrate;
+    i2c->hw.status = I2C_IC_STATUS_TFE_BITS;    // FIFO sempre vazio, barramento parado
+    return baudrate;
+}
+
+int i2c_write_blocking(i2c_inst_t *i2c, uint8_t addr, const uint8_t *src, size_t len, bool nostop) {
+    (void)i2c;
+    (void)nostop;
+    if (addr == SIM_ENDERECO_OLED) sim_oled_transacao(src, (uint32_t)len);
+    return (int)len;
+}
+
+int dma_claim_unused_channel(bool required) {
+    if (dma_proximo_livre >= SIM_DMA_CANAIS) {
+        if (required) abort();
+        return -1;
+    }
+    return dma_proximo_livre++;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel) {
+    (void)channel;
+    dma_channel_config c = { DMA_SIZE_32 };
+    return c;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger) {
+    (void)config;
+    dma[channel].destino = write_addr;
+    if (trigger) dma_channel_transfer_from_buffer_now(channel, read_addr, transfer_count);
+}
+
+static bool destino_pio(uint channel) {
+    return dma[channel].destino == (volatile void *)&sim_pio0->txf[0];
+}
+
+// Os dados chegam ao destino quando a última palavra sairia na linha:
+// 9 bits por byte no I2C, 24 bits a 800 kHz por pixel WS2812
+void dma_channel_transfer_from_buffer_now(uint channel, const volatile void *read_addr, uint32_t transfer_count) {
+    uint baud = sim_i2c1_inst.baudrate ? sim_i2c1_inst.baudrate : 100000u;
+    uint64_t duracao_us = destino_pio(channel) ? (uint64_t)transfer_count * 30u
+                                               : (uint64_t)transfer_count * 9u * 1000000u / baud;
+    taskENTER_CRITICAL();
+    dma[channel].origem = read_addr;
+    dma[channel].n = transfer_count;
+    dma[channel].fim_us = time_us_64() + duracao_us;
+    dma[channel].ativo = true;
+    taskEXIT_CRITICAL();
+    if (tarefa_irq != NULL) xTaskNotifyGive(tarefa_irq);
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled) { dma[channel].irq0 = enabled; }
+void dma_channel_set_irq1_enabled(uint channel, bool enabled) { dma[channel].irq1 = enabled; }
+
+/* ---------- IRQ ---------- */
+void irq_set_exclusive_handler(uint num, irq_handler_t handler) {
+    handlers[num][0] = handler;
+}
+
+void irq_add_shared_handler(uint num, irq_handler_t handler, uint8_t order_priority) {
+    (void)order_priority;
+    for (int i = 0; i < SIM_HANDLERS_POR_IRQ; ++i) {
+        if (handlers[num][i] == NULL) {
+            handlers[num][i] = handler;
+            return;
+        }
+    }
+}
+
+void irq_set_enabled(uint num, bool enabled) {
+    irq_habilitada[num] = enabled;
+}
+
+static void disparar_irq(uint num) {
+    if (!irq_habilitada[num]) return;
+    for (int i = 0; i < SIM_HANDLERS_POR_IRQ && handlers[num][i] != NULL; ++i) handlers[num][i]();
+}
+
+/* ---------- Alarmes ---------- */
+// Um alvo já passado é entregue pela SimIRQ assim que ela rodar, mesmo sem
+// fire_if_past: a callback nunca roda dentro de add_alarm_*
+alarm_id_t add_alarm_at(absolute_time_t time, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+    (void)fire_if_past;
+    alarm_id_t id = -1;
+    taskENTER_CRITICAL();
+    for (int i = 0; i < SIM_ALARMES; ++i) {
+        if (alarmes[i].ativo) continue;
+        if (++ultimo_alarme <= 0) ultimo_alarme = 1;
+        alarmes[i] = (sim_alarme_t){ ultimo_alarme, time, callback, user_data, true };
+        id = ultimo_alarme;
+        break;
+    }
+    taskEXIT_CRITICAL();
+    if (id > 0 && tarefa_irq != NULL) xTaskNotifyGive(tarefa_irq);
+    return id;
+}
+
+alarm_id_t add_alarm_in_us(uint64_t us, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+    return add_alarm_at(time_us_64() + us, callback, user_data, fire_if_past);
+}
+
+alarm_id_t add_alarm_in_ms(uint32_t ms, alarm_callback_t callback, void *user_data, bool fire_if_past) {
+    return add_alarm_in_us((uint64_t)ms * 1000u, callback, user_data, fire_if_past);
+}
+
+bool cancel_alarm(alarm_id_t alarm_id) {
+    bool cancelado = false;
+    taskENTER_CRITICAL();
+    for (int i = 0; i < SIM_ALARMES; ++i) {
+        if (alarmes[i].ativo && alarmes[i].id == alarm_id) {
+            alarmes[i].ativo = false;
+            cancelado = true;
+        }
+    }
+    taskEXIT_CRITICAL();
+    return cancelado;
+}
+
+// Roda as callbacks vencidas e devolve o alvo mais próximo dos que restam
+static uint64_t disparar_alarmes(uint64_t agora, uint64_t proximo) {
+    for (int i = 0; i < SIM_ALARMES; ++i) {
+        if (!alarmes[i].ativo) continue;
+        if (alarmes[i].alvo_us > agora) {
+            if (alarmes[i].alvo_us < proximo) proximo = alarmes[i].alvo_us;
+            continue;
+        }
+        alarm_id_t id = alarmes[i].id;
+        int64_t r = alarmes[i].callback(id, alarmes[i].dados);
+        taskENTER_CRITICAL();
+        // A callback pode ter cancelado o próprio alarme
+        if (alarmes[i].ativo && alarmes[i].id == id) {
+            if (r > 0) alarmes[i].alvo_us = time_us_64() + (uint64_t)r;
+            else if (r < 0) alarmes[i].alvo_us -= (uint64_t)r;
+            else alarmes[i].ativo = false;
+            if (alarmes[i].ativo && alarmes[i].alvo_us < proximo) proximo = alarmes[i].alvo_us;
+        }
+        taskEXIT_CRITICAL();
+    }
+    return proximo;
+}
+
+/* ---------- Spin locks ---------- */
+int spin_lock_claim_unused(bool required) {
+    if (spin_locks_usados >= SIM_SPIN_LOCKS) {
+        if (required) abort();
+        return -1;
+    }
+    return (int)spin_locks_usados++;
+}
+
+spin_lock_t *spin_lock_instance(uint lock_num) {
+    return &spin_locks[lock_num];
+}
+
+uint32_t spin_lock_blocking(spin_lock_t *lock) {
+    (void)lock;
+    taskENTER_CRITICAL();
+    return 0;
+}
+
+void spin_unlock(spin_lock_t *lock, uint32_t saved_irq) {
+    (void)lock; (void)saved_irq;
+    taskEXIT_CRITICAL();
+}
+
+/* ---------- stdio ---------- */
+bool stdio_init_all(void) {
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    sim_iniciar();
+    return true;
+}
+
+void stdio_set_chars_available_callback(void (*fn)(void *), void *param) {
+    stdio_callback = fn;
+    stdio_parametro = param;
+}
+
+// Caracteres de SIM_COMANDOS (depois do fim do roteiro) e então os do stdin real
+int getchar_timeout_us(uint32_t timeout_us) {
+    (void)timeout_us;
+    stdio_avisado = false;
+    if (comandos != NULL && *comandos != '\0' && time_us_64() >= fim_roteiro_us) return *comandos++;
+    if (stdin_fechado) return PICO_ERROR_TIMEOUT;
+    struct pollfd p = { STDIN_FILENO, POLLIN, 0 };
+    if (poll(&p, 1, 0) <= 0) return PICO_ERROR_TIMEOUT;
+    unsigned char c;
+    if (read(STDIN_FILENO, &c, 1) != 1) {
+        stdin_fechado = true;
+        return PICO_ERROR_TIMEOUT;
+    }
+    return c;
+}
+
+static bool stdin_pronto(void) {
+    if (stdin_fechado) return false;
+    struct pollfd p = { STDIN_FILENO, POLLIN, 0 };
+    return poll(&p, 1, 0) > 0;
+}
+
+/* ---------- Tarefa SimIRQ ---------- */
+static void sim_encerrar(void) {
+    double simulado_s = time_us_64() / 1e6;
+    double real_s = real_us() / 1e6;
+    fflush(saidas);
+    printf("sim: %.1f s simulados em %.1f s reais (%.1fx), %lu leituras ADC, %lu quadros OLED, %lu quadros WS2812\n",
+           simulado_s, real_s, real_s > 0 ? simulado_s / real_s : 0.0, (unsigned long)leituras_adc,
+           (unsigned long)sim_oled_quadros(), (unsigned long)quadros_ws2812);
+    fflush(stdout);
+    exit(0);
+}
+
+// Faz o papel do NVIC: entrega fins de DMA, alarmes, bordas do botão e avisos do stdio,
+// e fecha quadros WS2812 e OLED para os registros
+static void tarefa_sim_irq(void *parametro) {
+    (void)parametro;
+    bool comandos_entregues = false;
+    uint64_t encerrar_us = 0;
+
+    while (true) {
+        uint64_t agora = time_us_64();
+        uint64_t proximo = agora + SIM_STDIO_PERIODO_MS * 1000u;
+
+        for (uint ch = 0; ch < SIM_DMA_CANAIS; ++ch) {
+            if (!dma[ch].ativo) continue;
+            if (dma[ch].fim_us > agora) {
+                if (dma[ch].fim_us < proximo) proximo = dma[ch].fim_us;
+                continue;
+            }
+            dma[ch].ativo = false;
+            if (destino_pio(ch)) receber_pixels((const volatile uint32_t *)dma[ch].origem, dma[ch].n, agora);
+            else sim_oled_stream((const uint16_t *)dma[ch].origem, dma[ch].n);
+            if (dma[ch].irq0) { dma_hw->ints0 |= 1u << ch; disparar_irq(DMA_IRQ_0); }
+            if (dma[ch].irq1) { dma_hw->ints1 |= 1u << ch; disparar_irq(DMA_IRQ_1); }
+        }
+
+        proximo = disparar_alarmes(agora, proximo);
+
+        while (proximo_toque < n_toques && (uint64_t)toques_ms[proximo_toque] * 1000u <= agora) {
+            if (gpio_callback != NULL) gpio_callback(gpio_botao, GPIO_IRQ_EDGE_FALL);
+            proximo_toque++;
+        }
+        if (proximo_toque < n_toques && (uint64_t)toques_ms[proximo_toque] * 1000u < proximo) {
+            proximo = (uint64_t)toques_ms[proximo_toque] * 1000u;
+        }
+
+        if (n_pixels > 0 && agora - ultimo_pixel_us > SIM_LATCH_WS2812_US) fechar_quadro_ws2812();
+        sim_oled_salvar(diretorio_saida, agora);
+
+        if (agora >= fim_roteiro_us && !comandos_entregues) {
+            comandos_entregues = true;
+            encerrar_us = agora + 500000u;  // Tempo para os comandos serem atendidos
+            if (comandos != NULL && *comandos != '\0') stdio_avisado = false;
+        }
+        if (stdio_callback != NULL && !stdio_avisado
+            && (stdin_pronto() || (comandos_entregues && comandos != NULL && *comandos != '\0'))) {
+            stdio_avisado = true;
+            stdio_callback(stdio_parametro);
+        }
+        if (comandos_entregues && agora >= encerrar_us) sim_encerrar();
+
+        uint64_t espera_us = proximo > agora ? proximo - agora : 0;
+        TickType_t espera = pdMS_TO_TICKS(espera_us / 1000u);
+        ulTaskNotifyTake(pdTRUE, espera > 0 ? espera : 1);
+    }
+}
+
+/* ---------- Inicialização ---------- */
+static void carregar_roteiro(const char *caminho) {
+    FILE *f = fopen(caminho, "r");
+    if (f == NULL) {
+        fprintf(stderr, "sim: não foi possível abrir %s\n", caminho);
+        exit(1);
+    }
+    char linha[128];
+    uint32_t capacidade = 0;
+    while (fgets(linha, sizeof(linha), f) != NULL) {
+        unsigned long t, nivel, chuva;
+        if (linha[0] == '#' || sscanf(linha, "%lu,%lu,%lu", &t, &nivel, &chuva) != 3) continue;
+        if (n_roteiro == capacidade) {
+            capacidade = capacidade ? capacidade * 2 : 256;
+            roteiro = realloc(roteiro, capacidade * sizeof(sim_ponto_t));
+        }
+        roteiro[n_roteiro].tempo_ms = (uint32_t)t;
+        roteiro[n_roteiro].nivel = (uint16_t)(nivel > 4095 ? 4095 : nivel);
+        roteiro[n_roteiro].chuva = (uint16_t)(chuva > 4095 ? 4095 : chuva);
+        n_roteiro++;
+    }
+    fclose(f);
+    if (n_roteiro == 0) {
+        fprintf(stderr, "sim: %s não tem linhas \"tempo_ms,nivel_adc,chuva_adc\"\n", caminho);
+        exit(1);
+    }
+}
+
+void sim_iniciar(void) {
+    time_us_64();   // Marca o instante zero
+    memset(gpio_valor, -1, sizeof(gpio_valor));
+    for (int i = 0; i < 8; ++i) pwm[i].gpio = -1;
+
+    const char *sensores = getenv("SIM_SENSORES");
+    if (sensores != NULL) {
+        carregar_roteiro(sensores);
+    } else {
+        roteiro = (sim_ponto_t *)cenario_cheia;
+        n_roteiro = count_of(cenario_cheia);
+    }
+    const char *cauda = getenv("SIM_CAUDA_MS");
+    fim_roteiro_us = ((uint64_t)roteiro[n_roteiro - 1].tempo_ms + (cauda ? strtoul(cauda, NULL, 10) : 2000u)) * 1000u;
+
+    const char *toques = getenv("SIM_BOTAO");
+    while (toques != NULL && *toques != '\0' && n_toques < SIM_TOQUES_MAX) {
+        char *fim;
+        toques_ms[n_toques++] = (uint32_t)strtoul(toques, &fim, 10);
+        toques = *fim == ',' ? fim + 1 : NULL;
+    }
+    comandos = getenv("SIM_COMANDOS");
+
+    const char *saida = getenv("SIM_SAIDA");
+    if (saida != NULL) diretorio_saida = saida;
+    mkdir(diretorio_saida, 0755);
+    char caminho[256];
+    snprintf(caminho, sizeof(caminho), "%s/saidas.csv", diretorio_saida);
+    saidas = fopen(caminho, "w");
+    if (saidas == NULL) {
+        fprintf(stderr, "sim: não foi possível criar %s\n", caminho);
+        exit(1);
+    }
+    fprintf(saidas, "tempo_us;saida;canal;valor\n");
+
+    xTaskCreate(tarefa_sim_irq, "SimIRQ", configMINIMAL_STACK_SIZE, NULL, configMAX_PRIORITIES - 1, &tarefa_irq);
+}
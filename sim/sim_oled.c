@@ -0,0 +1,132 @@
+#include <stdio.h>
+#include <string.h>
+#include "sim.h"
+
+// GDDRAM e ponteiro de escrita no modo de endereçamento horizontal
+static uint8_t gddram[SIM_OLED_PAGINAS][SIM_OLED_LARGURA];
+static uint8_t salva[SIM_OLED_PAGINAS][SIM_OLED_LARGURA];
+static bool mudou = false;
+static uint8_t col_ini = 0, col_fim = SIM_OLED_LARGURA - 1;
+static uint8_t pag_ini = 0, pag_fim = SIM_OLED_PAGINAS - 1;
+static uint8_t col = 0, pag = 0;
+static uint32_t quadros = 0;
+
+// Comando em andamento e argumentos ainda esperados (chegam em transações separadas)
+static uint8_t comando = 0;
+static uint8_t args[2];
+static uint8_t args_faltando = 0, args_recebidos = 0;
+
+// Estado do decodificador dentro de uma transação
+static bool esperando_controle = true;
+static bool proximo_e_dado = false;
+static bool so_um = false;      // Co=1: só o próximo byte, depois outro byte de controle
+
+static uint8_t argumentos_do_comando(uint8_t c) {
+    switch (c) {
+    case 0x21: case 0x22:
+        return 2;
+    case 0x20: case 0x81: case 0xA8: case 0xD3: case 0xDA: case 0xD5: case 0xD9: case 0xDB: case 0x8D:
+        return 1;
+    default:
+        return 0;
+    }
+}
+
+static void executar_comando(void) {
+    char valor[8];
+    switch (comando) {
+    case 0x21:
+        col_ini = col = args[0] & 0x7F;
+        col_fim = args[1] & 0x7F;
+        break;
+    case 0x22:
+        pag_ini = pag = args[0] & 0x07;
+        pag_fim = args[1] & 0x07;
+        break;
+    case 0x81:
+        snprintf(valor, sizeof(valor), "%u", args[0]);
+        sim_registrar("oled_contraste", SIM_ENDERECO_OLED, valor);
+        break;
+    case 0xAE:
+    case 0xAF:
+        sim_registrar("oled_energia", SIM_ENDERECO_OLED, comando == 0xAF ? "1" : "0");
+        break;
+    default:
+        break;
+    }
+}
+
+static void byte_de_comando(uint8_t b) {
+    if (args_faltando > 0) {
+        args[args_recebidos++] = b;
+        if (--args_faltando == 0) executar_comando();
+        return;
+    }
+    comando = b;
+    args_recebidos = 0;
+    args_faltando = argumentos_do_comando(b);
+    if (args_faltando == 0) executar_comando();
+}
+
+static void byte_de_dado(uint8_t b) {
+    if (gddram[pag][col] != b) {
+        gddram[pag][col] = b;
+        mudou = true;
+    }
+    if (++col > col_fim) {
+        col = col_ini;
+        if (++pag > pag_fim) pag = pag_ini;
+    }
+}
+
+static void byte_recebido(uint8_t b) {
+    if (esperando_controle) {
+        so_um = (b & 0x80) != 0;
+        proximo_e_dado = (b & 0x40) != 0;
+        esperando_controle = false;
+        return;
+    }
+    if (proximo_e_dado) byte_de_dado(b);
+    else byte_de_comando(b);
+    if (so_um) esperando_controle = true;
+}
+
+void sim_oled_transacao(const uint8_t *bytes, uint32_t n) {
+    esperando_controle = true;
+    for (uint32_t i = 0; i < n; ++i) byte_recebido(bytes[i]);
+}
+
+void sim_oled_stream(const uint16_t *palavras, uint32_t n) {
+    esperando_controle = true;
+    for (uint32_t i = 0; i < n; ++i) {
+        byte_recebido((uint8_t)palavras[i]);
+        if (palavras[i] & 0x200) esperando_controle = true;  // STOP: próxima palavra abre outra transação
+    }
+}
+
+bool sim_oled_salvar(const char *diretorio, uint64_t tempo_us) {
+    if (!mudou) return false;
+    mudou = false;
+    if (memcmp(gddram, salva, sizeof(gddram)) == 0) return false;
+    memcpy(salva, gddram, sizeof(gddram));
+
+    char caminho[256];
+    snprintf(caminho, sizeof(caminho), "%s/oled_%09llu.pbm", diretorio, (unsigned long long)(tempo_us / 1000));
+    FILE *f = fopen(caminho, "w");
+    if (f == NULL) return false;
+    fprintf(f, "P1\n%d %d\n", SIM_OLED_LARGURA, SIM_OLED_PAGINAS * 8);
+    for (int y = 0; y < SIM_OLED_PAGINAS * 8; ++y) {
+        for (int x = 0; x < SIM_OLED_LARGURA; ++x) {
+            fputc((salva[y / 8][x] >> (y % 8)) & 1 ? '1' : '0', f);
+        }
+        fputc('\n', f);
+    }
+    fclose(f);
+    quadros++;
+    sim_registrar("oled", SIM_ENDERECO_OLED, strrchr(caminho, '/') + 1);
+    return true;
+}
+
+uint32_t sim_oled_quadros(void) {
+    return quadros;
+}
@@ -0,0 +1,115 @@
+#!/usr/bin/env python3
+"""Gera as tabelas de glifos do SSD1306 já no formato da GDDRAM.
+
+Lê lib/Display_Bibliotecas/font.h e escreve um header com cada glifo em
+colunas de 8 bits (bit 0 = linha de cima), já rotacionado quando o
+caractere original está desenhado por linhas. Assim o renderizador copia
+bytes direto para o ram_buffer, sem decidir nada por caractere.
+
+Uso: gerar_fonte.py <font.h> <saida.h>
+"""
+import re
+import sys
+
+NUM_GLIFOS = 71          # Glifos de 8x8 antes dos números pequenos
+INICIO_PEQUENOS = 568    # font[568]: números pequenos 5x5, um byte por linha
+
+# Caracteres especiais: (caractere, índice do glifo, desenhado por linhas?)
+ESPECIAIS = [
+    (':', 64, True),
+    ('.', 65, True),
+    ('>', 66, True),
+    ('-', 67, True),
+    (chr(127), 68, False),  # Símbolo Ohm
+    ('!', 69, True),
+    ('%', 70, True),
+]
+
+
+def ler_fonte(caminho):
+    with open(caminho, encoding='utf-8') as f:
+        texto = f.read()
+    texto = re.sub(r'//[^\n]*', '', texto)
+    corpo = texto[texto.index('{') + 1:texto.rindex('}')]
+    return [int(v, 16) for v in re.findall(r'0[xX][0-9a-fA-F]+', corpo)]
+
+
+def linhas_para_colunas(linhas, largura, msb):
+    """Converte bitmap por linhas (linha i, bit msb - c = coluna c) em colunas."""
+    colunas = []
+    for c in range(largura):
+        byte = 0
+        for i, linha in enumerate(linhas):
+            if (linha >> (msb - c)) & 1:
+                byte |= 1 << i
+        colunas.append(byte)
+    return colunas
+
+
+def formatar(bytes_):
+    return ', '.join('0x%02X' % b for b in bytes_)
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    fonte = ler_fonte(sys.argv[1])
+
+    rotacionados = {indice for _, indice, rot in ESPECIAIS if rot}
+    glifos = []
+    for g in range(NUM_GLIFOS):
+        bruto = fonte[g * 8:g * 8 + 8]
+        glifos.append(linhas_para_colunas(bruto, 8, 7) if g in rotacionados else bruto)
+
+    pequenos = []
+    for d in range(10):
+        bruto = fonte[INICIO_PEQUENOS + d * 5:INICIO_PEQUENOS + d * 5 + 5]
+        pequenos.append(linhas_para_colunas(bruto, 5, 4))
+
+    indice = [0] * 128
+    for c in range(10):
+        indice[ord('0') + c] = c + 1
+    for c in range(26):
+        indice[ord('A') + c] = c + 11
+        indice[ord('a') + c] = c + 37
+    for ch, g, _ in ESPECIAIS:
+        indice[ord(ch)] = g
+
+    out = []
+    out.append('// Gerado por tools/gerar_fonte.py a partir de font.h - não editar')
+    out.append('#ifndef FONT_COLUNAS_H')
+    out.append('#define FONT_COLUNAS_H')
+    out.append('')
+    out.append('#include <stdint.h>')
+    out.append('')
+    out.append('#define FONTE_LARGURA 8')
+    out.append('#define FONTE_PEQUENA_LARGURA 5')
+    out.append('#define FONTE_PEQUENA_MASCARA 0x1F  // 5 linhas de altura')
+    out.append('')
+    out.append('// Glifos 8x8 em colunas (bit 0 = linha de cima); índice 0 = não suportado')
+    out.append('static const uint8_t fonte_colunas[%d][FONTE_LARGURA] = {' % NUM_GLIFOS)
+    nomes = {g: (repr(chr(i)) if i != 127 else 'Ohm') for i, g in enumerate(indice) if g}
+    for g, col in enumerate(glifos):
+        out.append('    {%s}, // %s' % (formatar(col), nomes.get(g, '-')))
+    out.append('};')
+    out.append('')
+    out.append('// Números pequenos 5x5 em colunas')
+    out.append('static const uint8_t fonte_pequena_colunas[10][FONTE_PEQUENA_LARGURA] = {')
+    for d, col in enumerate(pequenos):
+        out.append('    {%s}, // %d' % (formatar(col), d))
+    out.append('};')
+    out.append('')
+    out.append('// Caractere ASCII -> índice em fonte_colunas')
+    out.append('static const uint8_t fonte_indice[128] = {')
+    for i in range(0, 128, 16):
+        out.append('    %s,' % ', '.join('%2d' % v for v in indice[i:i + 16]))
+    out.append('};')
+    out.append('')
+    out.append('#endif /* FONT_COLUNAS_H */')
+
+    with open(sys.argv[2], 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,77 @@
+#!/usr/bin/env python3
+"""Gera generated/pilhas.h a partir do perfil de pilhas (MODO_PERFIL_PILHAS).
+
+O firmware imprime, ao fim de cada volta do roteiro, uma linha por tarefa:
+    pilha;<nome>;<alocada>;<livre_min>;<usada>     (em palavras)
+Vale o maior uso visto de cada tarefa no log. O tamanho gerado é o uso
+medido mais uma margem (MARGEM_PCT do uso, no mínimo MARGEM_MIN_PALAVRAS),
+arredondado para cima em múltiplos de ALINHAMENTO_PALAVRAS. A margem cobre
+caminhos que o roteiro não exercita, como o relatório de saúde e
+mudanças de código feitas depois da medição.
+
+A entrada pode ser o log inteiro do terminal: só as linhas "pilha;" são lidas.
+O arquivo não vai para o repositório sem um perfil medido na placa: sem ele,
+main.c usa os tamanhos escolhidos à mão.
+
+Uso: gerar_pilhas.py <log.txt> <saida.h>
+     (com "-" a entrada é a entrada padrão)
+"""
+import re
+import sys
+
+MARGEM_PCT = 25
+MARGEM_MIN_PALAVRAS = 64
+ALINHAMENTO_PALAVRAS = 16
+
+
+def ler_usos(linhas):
+    usos = {}
+    for linha in linhas:
+        campos = linha.strip().split(';')
+        if len(campos) != 5 or campos[0] != 'pilha' or not campos[4].isdigit():
+            continue
+        nome, alocada, usada = campos[1], int(campos[2]), int(campos[4])
+        if usada >= alocada:
+            sys.exit('gerar_pilhas: %s usou a pilha inteira (%d palavras); aumente PERFIL_PILHA_PALAVRAS'
+                     % (nome, alocada))
+        usos[nome] = max(usos.get(nome, 0), usada)
+    return usos
+
+
+def tamanho(usada):
+    margem = max(usada * MARGEM_PCT // 100, MARGEM_MIN_PALAVRAS)
+    return -(-(usada + margem) // ALINHAMENTO_PALAVRAS) * ALINHAMENTO_PALAVRAS
+
+
+def macro(nome):
+    return 'PILHA_' + re.sub(r'\W', '_', nome).upper()
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    entrada = sys.stdin if sys.argv[1] == '-' else open(sys.argv[1], encoding='utf-8', errors='replace')
+    with entrada:
+        usos = ler_usos(entrada)
+    if not usos:
+        sys.exit('gerar_pilhas: nenhuma linha "pilha;" no log (o roteiro completou uma volta?)')
+
+    linhas = ['// Gerado por tools/gerar_pilhas.py - não editar',
+              '// Uso medido com MODO_PERFIL_PILHAS + max(%d %%, %d palavras), em múltiplos de %d'
+              % (MARGEM_PCT, MARGEM_MIN_PALAVRAS, ALINHAMENTO_PALAVRAS),
+              '// Só pilhas de tarefas: as callbacks de alarmes (animacao.c, sinais.c) e as',
+              '// IRQs rodam na pilha de exceções, que o perfil não mede',
+              '#ifndef PILHAS_H',
+              '#define PILHAS_H',
+              '',
+              '// Tamanho das pilhas das tarefas, em palavras']
+    for nome in sorted(usos):
+        linhas.append('#define %s %d  // Usada: %d' % (macro(nome), tamanho(usos[nome]), usos[nome]))
+    linhas += ['', '#endif /* PILHAS_H */', '']
+
+    with open(sys.argv[2], 'w', encoding='utf-8') as f:
+        f.write('\n'.join(linhas))
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,67 @@
+#!/usr/bin/env python3
+"""Gera as tabelas de conversão dos sensores em ponto fixo.
+
+As tabelas têm 257 pontos sobre a leitura normalizada em 16 bits
+(0..65535) e são interpoladas linearmente em sensor.c. Os valores saem em
+centésimos (10000 = 100,00 %, 3500 = 35,00 mm/h), então a tarefa de
+medição não precisa de nenhuma operação em ponto flutuante.
+
+Uso: gerar_tabelas_sensor.py <saida.h>
+"""
+import sys
+
+PONTOS = 257  # Passo de 256 na entrada de 16 bits
+
+
+def percentual_para_mmh(percentual):
+    """Mesma curva por faixas usada originalmente na tarefa de medição."""
+    if percentual <= 0.0:
+        return 0.0
+    if percentual < 30.0:
+        return (percentual / 30.0) * 5.0                  # 0-5 mm/h
+    if percentual < 60.0:
+        return 5.0 + ((percentual - 30.0) / 30.0) * 10.0  # 5-15 mm/h
+    if percentual < 80.0:
+        return 15.0 + ((percentual - 60.0) / 20.0) * 15.0 # 15-30 mm/h
+    if percentual < 95.0:
+        return 30.0 + ((percentual - 80.0) / 15.0) * 5.0  # 30-35 mm/h
+    return 35.0
+
+
+def tabela(nome, comentario, valores):
+    linhas = ['// %s' % comentario,
+              'static const uint16_t %s[SENSOR_TABELA_PONTOS] = {' % nome]
+    for i in range(0, len(valores), 12):
+        linhas.append('    %s,' % ', '.join('%5d' % v for v in valores[i:i + 12]))
+    linhas.append('};')
+    return linhas
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+
+    percentuais = [min(100.0, 100.0 * i / (PONTOS - 1)) for i in range(PONTOS)]
+    pct = [round(p * 100) for p in percentuais]
+    mmh = [round(percentual_para_mmh(p) * 100) for p in percentuais]
+
+    out = ['// Gerado por tools/gerar_tabelas_sensor.py - não editar',
+           '#ifndef TABELAS_SENSOR_H',
+           '#define TABELAS_SENSOR_H',
+           '',
+           '#include <stdint.h>',
+           '',
+           '#define SENSOR_TABELA_PONTOS %d' % PONTOS,
+           '#define SENSOR_TABELA_SHIFT 8  // Bits da entrada abaixo do índice',
+           '']
+    out += tabela('tabela_percentual_x100', 'Leitura normalizada -> percentual (centésimos de %)', pct)
+    out.append('')
+    out += tabela('tabela_chuva_mmh_x100', 'Leitura normalizada -> chuva (centésimos de mm/h)', mmh)
+    out += ['', '#endif /* TABELAS_SENSOR_H */']
+
+    with open(sys.argv[1], 'w', encoding='utf-8', newline='\n') as f:
+        f.write('\n'.join(out) + '\n')
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,118 @@
+#!/usr/bin/env python3
+"""Converte o rastro do escalonador (comando 'r' no terminal) para JSON.
+
+O formato de saída é o Trace Event Format do Chrome, aberto direto em
+https://ui.perfetto.dev ou em chrome://tracing. Cada núcleo vira uma
+trilha com uma fatia por execução de tarefa; envios, recebimentos e
+bloqueios aparecem como eventos instantâneos na fatia da tarefa que os
+causou.
+
+A entrada pode ser o log inteiro do terminal: só as linhas "rastro;"
+são lidas, e vale o último dump encontrado.
+
+Uso: rastro_perfetto.py <log.txt> <saida.json>
+     (com "-" a entrada é a entrada padrão)
+"""
+import json
+import struct
+import sys
+
+# Mesmos valores de rastro_tipo_t em lib/RTOS_Bibliotecas/rastro.h
+TAREFA_ENTROU = 1
+FILA_ENVIO = 2
+FILA_RECEBIDO = 3
+FILA_BLOQUEIO_ENVIO = 4
+FILA_BLOQUEIO_RECEBE = 5
+NOTIFICACAO_BLOQUEIO = 6
+ATRASO = 7
+
+EVENTO = struct.Struct('<IBBH')  # rastro_evento_t: 8 bytes
+
+NOMES_INSTANTANEOS = {
+    FILA_ENVIO: 'envio %s',
+    FILA_RECEBIDO: 'recebido %s',
+    FILA_BLOQUEIO_ENVIO: 'espera espaco %s',
+    FILA_BLOQUEIO_RECEBE: 'espera dado %s',
+    NOTIFICACAO_BLOQUEIO: 'espera notificacao',
+    ATRASO: 'vTaskDelay',
+}
+
+
+def ler_dump(linhas):
+    """Devolve (nucleos, tarefas, filas, eventos) do último dump completo."""
+    dump = None
+    completo = None
+    for linha in linhas:
+        campos = linha.strip().split(';')
+        if not campos or campos[0] != 'rastro':
+            continue
+        tipo = campos[1]
+        if tipo == 'inicio':
+            dump = {'nucleos': int(campos[4]), 'tarefas': {}, 'filas': {}, 'dados': bytearray()}
+        elif dump is None:
+            continue
+        elif tipo == 'tarefa':
+            dump['tarefas'][int(campos[2])] = campos[3]
+        elif tipo == 'fila':
+            dump['filas'][int(campos[2])] = campos[3]
+        elif tipo == 'dados':
+            dump['dados'] += bytes.fromhex(campos[2])
+        elif tipo == 'fim':
+            completo = dump
+            dump = None
+    if completo is None:
+        sys.exit('nenhum dump "rastro;inicio ... rastro;fim" na entrada')
+    eventos = [EVENTO.unpack_from(completo['dados'], i)
+               for i in range(0, len(completo['dados']) - EVENTO.size + 1, EVENTO.size)]
+    return completo['nucleos'], completo['tarefas'], completo['filas'], eventos
+
+
+def converter(nucleos, tarefas, filas, eventos):
+    saida = [{'ph': 'M', 'pid': 0, 'name': 'process_name', 'args': {'name': 'RTOS_filas'}}]
+    for n in range(nucleos):
+        saida.append({'ph': 'M', 'pid': 0, 'tid': n, 'name': 'thread_name',
+                      'args': {'name': 'nucleo %d' % n}})
+
+    # time_us_32() dá a volta a cada ~71 min: desdobra em relação ao evento anterior
+    base = eventos[0][0] if eventos else 0
+    desdobrado = 0
+    anterior = base
+    atual = {}  # núcleo -> (tarefa, início)
+    fim = 0
+    for tempo, tipo, nucleo, objeto in eventos:
+        desdobrado += (tempo - anterior) & 0xFFFFFFFF
+        anterior = tempo
+        ts = desdobrado
+        fim = ts
+        if tipo == TAREFA_ENTROU:
+            if nucleo in atual:
+                tarefa, inicio = atual[nucleo]
+                saida.append({'ph': 'X', 'pid': 0, 'tid': nucleo, 'ts': inicio, 'dur': ts - inicio,
+                              'name': tarefas.get(tarefa, 'tarefa %d' % tarefa)})
+            atual[nucleo] = (objeto, ts)
+        elif tipo in NOMES_INSTANTANEOS:
+            nome = NOMES_INSTANTANEOS[tipo]
+            if '%s' in nome:
+                nome = nome % filas.get(objeto, 'fila %d' % objeto)
+            saida.append({'ph': 'i', 's': 't', 'pid': 0, 'tid': nucleo, 'ts': ts, 'name': nome})
+
+    # Fecha as fatias ainda abertas no último evento gravado
+    for nucleo, (tarefa, inicio) in atual.items():
+        saida.append({'ph': 'X', 'pid': 0, 'tid': nucleo, 'ts': inicio, 'dur': fim - inicio,
+                      'name': tarefas.get(tarefa, 'tarefa %d' % tarefa)})
+    return {'traceEvents': saida, 'displayTimeUnit': 'ms'}
+
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(__doc__)
+    entrada = sys.stdin if sys.argv[1] == '-' else open(sys.argv[1], encoding='utf-8', errors='replace')
+    with entrada:
+        nucleos, tarefas, filas, eventos = ler_dump(entrada)
+    with open(sys.argv[2], 'w', encoding='utf-8') as f:
+        json.dump(converter(nucleos, tarefas, filas, eventos), f)
+    print('%d eventos, %d tarefas -> %s' % (len(eventos), len(tarefas), sys.argv[2]))
+
+
+if __name__ == '__main__':
+    main()
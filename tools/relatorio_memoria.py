@@ -0,0 +1,106 @@
+#!/usr/bin/env python3
+"""Relatório de memória por subsistema a partir do mapa do link (GNU ld).
+
+Soma, por subsistema, os bytes que cada seção de entrada ocupa na flash e
+na SRAM do RP2040 e lista os maiores objetos em SRAM (pilhas, filas e
+buffers estáticos aparecem pelo nome com -fdata-sections). O .data conta
+nas duas memórias: a imagem fica na flash e é copiada para a SRAM no boot.
+
+Subsistemas: main, cada lib/<Nome>_Bibliotecas, FreeRTOS, pico-sdk e libc
+(newlib, libgcc e o que mais vier de arquivos .a da toolchain).
+
+A saída é uma tabela separada por ';', como os relatórios do terminal.
+
+Uso: relatorio_memoria.py <RTOS_filas.elf.map> [maiores]
+"""
+import re
+import sys
+from collections import defaultdict
+
+# Seções de saída do memmap_default.ld do Pico SDK
+SECOES_FLASH = {'.boot2', '.text', '.rodata', '.ARM.extab', '.ARM.exidx', '.binary_info', '.data'}
+SECOES_RAM = {'.ram_vector_table', '.data', '.uninitialized_data', '.scratch_x', '.scratch_y', '.bss'}
+
+SAIDA = re.compile(r'^(\.[\w.]+)\s+0x[0-9a-f]+\s+0x[0-9a-f]+')
+ENTRADA = re.compile(r'^ (\S+)\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$')
+SO_NOME = re.compile(r'^ (\S+)$')
+CONTINUACAO = re.compile(r'^\s+0x([0-9a-f]+)\s+0x([0-9a-f]+)\s+(\S.*)$')
+BIBLIOTECA = re.compile(r'lib/(\w+)_Bibliotecas/')
+
+
+def subsistema(arquivo):
+    m = BIBLIOTECA.search(arquivo)
+    if m:
+        return m.group(1)
+    if 'FreeRTOS' in arquivo:
+        return 'FreeRTOS'
+    if 'pico-sdk' in arquivo or 'pico_' in arquivo or 'hardware_' in arquivo or 'boot_stage2' in arquivo:
+        return 'pico-sdk'
+    if arquivo.endswith('main.c.obj') or arquivo.endswith('main.c.o'):
+        return 'main'
+    if '.a(' in arquivo or arquivo.endswith('.a'):
+        return 'libc'
+    return 'outros'
+
+
+def secoes(linhas):
+    """Gera (seção de saída, seção de entrada, tamanho, arquivo) de cada seção de entrada."""
+    saida = None
+    pendente = None
+    dentro = False
+    for linha in linhas:
+        linha = linha.rstrip('\n')
+        if not dentro:
+            dentro = linha.startswith('Linker script and memory map')
+            continue
+        m = SAIDA.match(linha)
+        if m or (linha and not linha[0].isspace()):
+            saida = m.group(1) if m else linha.split()[0]
+            pendente = None
+            continue
+        m = ENTRADA.match(linha)
+        if m:
+            yield saida, m.group(1), int(m.group(3), 16), m.group(4)
+            pendente = None
+            continue
+        m = SO_NOME.match(linha)
+        if m and not linha.strip().startswith('*'):
+            pendente = m.group(1)
+            continue
+        m = CONTINUACAO.match(linha)
+        if m and pendente is not None:
+            yield saida, pendente, int(m.group(2), 16), m.group(3)
+        pendente = None
+
+
+def main():
+    if len(sys.argv) < 2:
+        sys.exit(__doc__)
+    maiores = int(sys.argv[2]) if len(sys.argv) > 2 else 15
+
+    flash = defaultdict(int)
+    ram = defaultdict(int)
+    objetos_ram = []
+    with open(sys.argv[1], encoding='utf-8', errors='replace') as f:
+        for saida, entrada, tamanho, arquivo in secoes(f):
+            if tamanho == 0 or arquivo.startswith('load address'):
+                continue
+            nome = subsistema(arquivo)
+            if saida in SECOES_FLASH:
+                flash[nome] += tamanho
+            if saida in SECOES_RAM:
+                ram[nome] += tamanho
+                objetos_ram.append((tamanho, entrada, nome))
+
+    print('memoria;subsistema;flash;ram')
+    for nome in sorted(set(flash) | set(ram), key=lambda n: -ram[n]):
+        print('memoria;%s;%d;%d' % (nome, flash[nome], ram[nome]))
+    print('memoria;total;%d;%d' % (sum(flash.values()), sum(ram.values())))
+
+    print('ram;secao;subsistema;bytes')
+    for tamanho, entrada, nome in sorted(objetos_ram, reverse=True)[:maiores]:
+        print('ram;%s;%s;%d' % (entrada, nome, tamanho))
+
+
+if __name__ == '__main__':
+    main()
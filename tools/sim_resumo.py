@@ -0,0 +1,66 @@
+#!/usr/bin/env python3
+"""Resume as saídas de uma execução da simulação (sim/) para regressão.
+
+O tempo da simulação é o relógio do host acelerado, então os instantes de
+saidas.csv variam de uma execução para outra. O resumo guarda só o que não
+depende do escalonamento do host:
+    resumo;<saida>;<canal>;<v1> <v2> ...     valores distintos, na ordem em que apareceram
+    resumo;oled;<canal>;pbm_ok               todos os quadros são PBM P1 128x64 válidos
+A saída "oled" (nome do PBM) não entra nos valores: cada quadro tem o seu.
+Um PBM inválido, ausente ou nenhum quadro encerra com erro.
+
+Uso: sim_resumo.py <diretorio SIM_SAIDA>
+"""
+import os
+import sys
+
+LARGURA = 128
+ALTURA = 64
+
+
+def pbm_valido(caminho):
+    try:
+        with open(caminho) as f:
+            tokens = f.read().split()
+    except OSError:
+        return False
+    if tokens[:3] != ['P1', str(LARGURA), str(ALTURA)]:
+        return False
+    linhas = tokens[3:]
+    return len(linhas) == ALTURA and all(len(l) == LARGURA and set(l) <= {'0', '1'} for l in linhas)
+
+
+def resumir(diretorio):
+    valores = {}
+    quadros = {}
+    with open(os.path.join(diretorio, 'saidas.csv')) as f:
+        for linha in f:
+            campos = linha.strip().split(';')
+            if len(campos) != 4 or not campos[0].isdigit():
+                continue
+            _, saida, canal, valor = campos
+            if saida == 'oled':
+                if not pbm_valido(os.path.join(diretorio, valor)):
+                    sys.exit(f'PBM inválido ou ausente: {valor}')
+                quadros[canal] = quadros.get(canal, 0) + 1
+                continue
+            vistos = valores.setdefault((saida, canal), [])
+            if valor not in vistos:
+                vistos.append(valor)
+    if not quadros:
+        sys.exit('nenhum quadro do OLED em saidas.csv')
+
+    linhas = [f'resumo;{saida};{canal};{" ".join(v)}' for (saida, canal), v in valores.items()]
+    linhas += [f'resumo;oled;{canal};pbm_ok' for canal in quadros]
+    return sorted(linhas)
+
+
+def main():
+    if len(sys.argv) != 2:
+        sys.exit(__doc__)
+    for linha in resumir(sys.argv[1]):
+        print(linha)
+
+
+if __name__ == '__main__':
+    main()